@@ -0,0 +1,166 @@
+# Font subset compiler
+#
+# Picks the glyphs used by the UI out of a GT20L16J1Y ROM dump and emits
+# src/FontSubsetData.cpp: a Ku-Ten sorted index and the glyphs already in
+# the T6963C CGRAM layout (see transposeGlyph in KanjiText.cpp), kept in
+# flash. Glyphs found there never touch the SPI ROM.
+#
+# As a PlatformIO pre-build script the inputs come from platformio.ini:
+#   custom_font_rom    = ROM dump (binary, 256KB)
+#   custom_font_corpus = UTF-8 text files with every string the UI shows
+# Without a dump an empty subset is written and everything comes from the ROM.
+#   custom_font_sim    = yes: compile from the contents FontRomSim serves
+#                        without a dump (the host build), so its flash
+#                        subset paths run against the simulated ROM
+#
+# Standalone:
+#   python3 fontsubset.py --rom dump.bin --corpus fonts/corpus.txt [--out src/FontSubsetData.cpp]
+#   python3 fontsubset.py --sim --corpus fonts/host_corpus.txt
+
+import os
+import sys
+
+OUT = 'src/FontSubsetData.cpp'
+ROM_SIZE = 0x40000
+
+
+def kuten_address(code):
+    """ROM address and width of a Ku-Ten code (GT20L16J1Y_FONT::kuten_address)"""
+    msb = code >> 8
+    lsb = code & 0xFF
+    address = 0
+    if 1 <= msb <= 15 and 1 <= lsb <= 94:
+        address = ((msb - 1) * 94 + (lsb - 1)) * 32
+    elif 16 <= msb <= 47 and 1 <= lsb <= 94:
+        address = ((msb - 16) * 94 + (lsb - 1)) * 32 + 0x0AA40
+    elif 48 <= msb <= 84 and 1 <= lsb <= 94:
+        address = ((msb - 48) * 94 + (lsb - 1)) * 32 + 0x21CDF
+    elif msb == 85 and 1 <= lsb <= 94:
+        address = ((msb - 85) * 94 + (lsb - 1)) * 32 + 0x3C4A0
+    elif 88 <= msb <= 89 and 1 <= lsb <= 94:
+        address = ((msb - 88) * 94 + (lsb - 1)) * 32 + 0x3D060
+    elif msb == 0 and 0x20 <= lsb <= 0x7F:
+        address = (lsb - 0x20) * 16 + 255968
+    if msb == 0 and 0x20 <= lsb <= 0x7F:
+        return address, 8
+    return address, 16
+
+
+def sjis_to_kuten(code):
+    """GT20L16J1Y_FONT::sjis_to_kuten"""
+    c1 = code >> 8
+    c2 = code & 0xFF
+    seq = (c1 - 129 if c1 <= 159 else c1 - 193) * 188 + (c2 - 64 if c2 <= 126 else c2 - 65)
+    return ((seq // 94 + 1) << 8) | (seq % 94 + 1)
+
+
+def char_to_kuten(ch):
+    if 0x20 <= ord(ch) <= 0x7E:
+        return ord(ch)
+    try:
+        sjis = ch.encode('cp932')
+    except UnicodeEncodeError:
+        return None
+    if len(sjis) != 2:
+        return None
+    return sjis_to_kuten((sjis[0] << 8) | sjis[1])
+
+
+def transpose_glyph(bitmap, width):
+    """ROM column bytes -> four 8x8 CGRAM cells (UL, UR, LL, LR)"""
+    if width == 8:
+        bitmap = bitmap[0:8] + bytes(8) + bitmap[8:16] + bytes(8)
+    cg = bytearray(32)
+    for cell in range(4):
+        for row in range(8):
+            value = 0
+            for col in range(8):
+                if bitmap[cell * 8 + col] & (1 << row):
+                    value |= 0x80 >> col
+            cg[cell * 8 + row] = value
+    return bytes(cg)
+
+
+def sim_rom():
+    """What FontRomSim serves without a dump: every byte derived from its address"""
+    return bytes(((i * 2654435761) & 0xFFFFFFFF) >> 24 for i in range(ROM_SIZE))
+
+
+def compile_subset(rom_path, corpus_paths, out_path, sim=False):
+    codes = set()
+    glyphs = []
+    rom = None
+
+    if sim:
+        rom = sim_rom()
+    elif rom_path and os.path.exists(rom_path):
+        with open(rom_path, 'rb') as f:
+            rom = f.read()
+    elif rom_path:
+        print('fontsubset: ROM dump not found: ' + rom_path)
+
+    if rom is not None:
+        for path in corpus_paths:
+            with open(path, encoding='utf-8') as f:
+                for ch in f.read():
+                    code = char_to_kuten(ch)
+                    if code is not None:
+                        codes.add(code)
+        for code in sorted(codes):
+            address, width = kuten_address(code)
+            bitmap = rom[address:address + width * 2]
+            if len(bitmap) < width * 2:
+                continue
+            glyphs.append((code, width, transpose_glyph(bitmap, width)))
+
+    lines = []
+    lines.append('// Generated by fontsubset.py -- do not edit')
+    lines.append('#include "FontSubset.h"')
+    lines.append('')
+    lines.append('const unsigned int fontSubsetCount = %d;' % len(glyphs))
+    lines.append('')
+    lines.append('const unsigned short fontSubsetCodes[%d] = {' % max(len(glyphs), 1))
+    for code, width, cg in glyphs:
+        lines.append('    0x%04x,' % code)
+    lines.append('};')
+    lines.append('')
+    lines.append('const unsigned char fontSubsetWidths[%d] = {' % max(len(glyphs), 1))
+    for code, width, cg in glyphs:
+        lines.append('    %d,' % width)
+    lines.append('};')
+    lines.append('')
+    lines.append('const unsigned char fontSubsetGlyphs[%d][32] = {' % max(len(glyphs), 1))
+    for code, width, cg in glyphs:
+        lines.append('    {' + ', '.join('0x%02x' % b for b in cg) + '},')
+    lines.append('};')
+    text = '\n'.join(lines) + '\n'
+
+    # Keep the timestamp when nothing changed, so the build is not redone
+    if os.path.exists(out_path):
+        with open(out_path) as f:
+            if f.read() == text:
+                return len(glyphs)
+    with open(out_path, 'w') as f:
+        f.write(text)
+    print('fontsubset: %d glyphs -> %s' % (len(glyphs), out_path))
+    return len(glyphs)
+
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description='GT20L16J1Y font subset compiler')
+    parser.add_argument('--rom', default='')
+    parser.add_argument('--sim', action='store_true', help='use the simulated ROM of the host build')
+    parser.add_argument('--corpus', action='append', default=[])
+    parser.add_argument('--out', default=OUT)
+    args = parser.parse_args()
+    compile_subset(args.rom, args.corpus, args.out, args.sim)
+else:
+    Import("env")
+    project_dir = env['PROJECT_DIR']
+    rom = env.GetProjectOption('custom_font_rom', '')
+    corpus = env.GetProjectOption('custom_font_corpus', '').split()
+    sim = env.GetProjectOption('custom_font_sim', 'no') == 'yes'
+    compile_subset(os.path.join(project_dir, rom) if rom else '',
+                   [os.path.join(project_dir, c) for c in corpus],
+                   os.path.join(project_dir, OUT), sim)
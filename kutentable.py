@@ -0,0 +1,94 @@
+# Unicode -> Ku-Ten table generator
+#
+# Writes src/UnicodeKutenTable.cpp for the UTF-8 decoder (Utf8Kuten.h):
+# a two-level table over the BMP. The top level maps (code point >> 6) to
+# a block; a block is a 64-bit presence mask plus the index of its first
+# entry in a dense Ku-Ten array, so a lookup is one popcount.
+#
+#   python3 kutentable.py [--out src/UnicodeKutenTable.cpp]
+
+import argparse
+
+
+def sjis_to_kuten(code):
+    """GT20L16J1Y_FONT::sjis_to_kuten"""
+    c1 = code >> 8
+    c2 = code & 0xFF
+    seq = (c1 - 129 if c1 <= 159 else c1 - 193) * 188 + (c2 - 64 if c2 <= 126 else c2 - 65)
+    return ((seq // 94 + 1) << 8) | (seq % 94 + 1)
+
+
+def rom_has(kuten):
+    ku = kuten >> 8
+    ten = kuten & 0xFF
+    if ten < 1 or ten > 94:
+        return False
+    return 1 <= ku <= 85 or 88 <= ku <= 89
+
+
+def build():
+    mapping = {}
+    for cp in range(0x80, 0x10000):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        try:
+            sjis = chr(cp).encode('cp932')
+        except UnicodeEncodeError:
+            continue
+        if len(sjis) != 2:
+            continue
+        kuten = sjis_to_kuten((sjis[0] << 8) | sjis[1])
+        if rom_has(kuten):
+            mapping[cp] = kuten
+    return mapping
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Unicode to Ku-Ten table generator')
+    parser.add_argument('--out', default='src/UnicodeKutenTable.cpp')
+    args = parser.parse_args()
+
+    mapping = build()
+    top = []
+    blocks = []
+    kuten = []
+    for block in range(0x10000 >> 6):
+        codes = [cp for cp in range(block << 6, (block + 1) << 6) if cp in mapping]
+        if not codes:
+            top.append(0xFFFF)
+            continue
+        mask = 0
+        for cp in codes:
+            mask |= 1 << (cp & 63)
+        top.append(len(blocks))
+        blocks.append((mask & 0xFFFFFFFF, mask >> 32, len(kuten)))
+        kuten.extend(mapping[cp] for cp in codes)
+
+    lines = []
+    lines.append('// Generated by kutentable.py -- do not edit')
+    lines.append('#include "Utf8Kuten.h"')
+    lines.append('')
+    lines.append('// %d code points, %d blocks' % (len(kuten), len(blocks)))
+    lines.append('const unsigned short unicodeKutenTop[%d] = {' % len(top))
+    for i in range(0, len(top), 8):
+        lines.append('    ' + ' '.join('0x%04x,' % v for v in top[i:i + 8]))
+    lines.append('};')
+    lines.append('')
+    lines.append('const UnicodeKutenBlock unicodeKutenBlocks[%d] = {' % len(blocks))
+    for lo, hi, base in blocks:
+        lines.append('    {0x%08xUL, 0x%08xUL, %d},' % (lo, hi, base))
+    lines.append('};')
+    lines.append('')
+    lines.append('const unsigned short unicodeKutenCodes[%d] = {' % len(kuten))
+    for i in range(0, len(kuten), 8):
+        lines.append('    ' + ' '.join('0x%04x,' % v for v in kuten[i:i + 8]))
+    lines.append('};')
+
+    with open(args.out, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+    size = len(top) * 2 + len(blocks) * 12 + len(kuten) * 2
+    print('kutentable: %d code points, %d blocks, %d bytes -> %s' % (len(kuten), len(blocks), size, args.out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,217 @@
+# Remote LCD mirror viewer
+#
+# Decodes the VramMirror stream (src/VramMirror.h) from a serial port or a
+# capture file, rebuilds the 240x128 screen and prints the size of every
+# frame. Text codes 0x80-0xFF are drawn from the mirrored CGRAM; the
+# controller's internal character ROM is not available, so other non-blank
+# codes are drawn as boxes (--text prints the text plane as ASCII). Anything
+# before the first "LM" header is skipped, and deltas are ignored until the
+# first keyframe.
+#
+#   python3 mirrorview.py /dev/ttyACM0 [--baud 115200] [--pbm screen.pbm] [--text]
+#   python3 mirrorview.py mirror.bin [--pbm screen.pbm] [--hash]
+
+import argparse
+import os
+import stat
+import struct
+import termios
+
+HEADER = struct.Struct('<2sBHHHBBBBBHHHHH')
+
+
+class Stream:
+    def __init__(self, f):
+        self.f = f
+        self.count = 0
+
+    def read(self, n):
+        data = b''
+        while len(data) < n:
+            chunk = self.f.read(n - len(data))
+            if not chunk:
+                raise EOFError
+            data += chunk
+        self.count += n
+        return data
+
+    def byte(self):
+        return self.read(1)[0]
+
+
+def open_port(path, baud):
+    fd = os.open(path, os.O_RDONLY | os.O_NOCTTY)
+    attrs = termios.tcgetattr(fd)
+    speed = getattr(termios, 'B%d' % baud)
+    # raw 8N1
+    attrs[0] = 0
+    attrs[1] = 0
+    attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+    attrs[3] = 0
+    attrs[4] = speed
+    attrs[5] = speed
+    attrs[6][termios.VMIN] = 1
+    attrs[6][termios.VTIME] = 0
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    return os.fdopen(fd, 'rb', buffering=0)
+
+
+def sync(stream):
+    """Skip to the next "LM" and return the header fields"""
+    previous = 0
+    while True:
+        b = stream.byte()
+        if previous == ord('L') and b == ord('M'):
+            rest = stream.read(HEADER.size - 2)
+            fields = HEADER.unpack(b'LM' + rest)
+            kind, width, height = fields[1], fields[8], fields[9]
+            if kind in (0, 1) and 0 < width <= 64 and 0 < height <= 32:
+                return fields
+        previous = b
+
+
+def decode(stream, image):
+    """Apply the tokens of one frame to image (XOR), False if they overrun it"""
+    pos = 0
+    while True:
+        token = stream.byte()
+        if token == 0:
+            return pos <= len(image)
+        if token < 0x80:
+            data = stream.read(token)
+            for i, x in enumerate(data):
+                if pos + i < len(image):
+                    image[pos + i] ^= x
+            pos += token
+        elif token < 0xC0:
+            n = (token & 0x3F) + 2
+            v = stream.byte()
+            for i in range(pos, min(pos + n, len(image))):
+                image[i] ^= v
+            pos += n
+        else:
+            pos += ((token & 0x3F) << 8 | stream.byte()) + 1
+
+
+class Screen:
+    def __init__(self, header):
+        (_, _, _, self.text_home, self.grph_home, self.offset, self.mode, self.display,
+         self.width, self.height, self.vram_start, self.vram_end, self.cgram_start,
+         self.cgram_end, _) = header
+        self.vram_size = self.vram_end - self.vram_start
+
+    def byte(self, image, addr):
+        if self.vram_start <= addr < self.vram_end:
+            return image[addr - self.vram_start]
+        if self.cgram_start <= addr < self.cgram_end:
+            return image[self.vram_size + addr - self.cgram_start]
+        return 0
+
+    def glyph(self, image, code):
+        if code >= 0x80 or (self.mode != 0xFF and self.mode & 0x08):
+            base = (self.offset << 11) + code * 8
+            return [self.byte(image, base + i) for i in range(8)]
+        if code == 0:
+            return [0] * 8
+        return [0xFF] + [0x81] * 6 + [0xFF]
+
+    def render(self, image):
+        """Pixel rows of the screen as lists of bytes"""
+        display = 0x0C if self.display == 0xFF else self.display
+        mode = 0 if self.mode == 0xFF else self.mode & 0x03
+        rows = []
+        for y in range(self.height * 8):
+            row = []
+            for x in range(self.width):
+                t = 0
+                if display & 0x04:
+                    code = self.byte(image, self.text_home + (y // 8) * self.width + x)
+                    t = self.glyph(image, code)[y % 8]
+                g = self.byte(image, self.grph_home + y * self.width + x) if display & 0x08 else 0
+                if mode == 1:
+                    row.append(t ^ g)
+                elif mode == 3:
+                    row.append(t & g)
+                else:
+                    row.append(t | g)
+            rows.append(row)
+        return rows
+
+    def text(self, image):
+        lines = []
+        for y in range(self.height):
+            line = ''
+            for x in range(self.width):
+                code = self.byte(image, self.text_home + y * self.width + x)
+                line += chr(code + 0x20) if code < 0x5F else '#'
+            lines.append(line)
+        return lines
+
+
+def write_pbm(path, rows):
+    with open(path + '.tmp', 'wb') as f:
+        f.write(b'P4\n%d %d\n' % (len(rows[0]) * 8, len(rows)))
+        for row in rows:
+            f.write(bytes(row))
+    os.replace(path + '.tmp', path)
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def main():
+    parser = argparse.ArgumentParser(description='View a VramMirror stream')
+    parser.add_argument('source', help='serial port or capture file')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--pbm', help='write the screen here after every frame')
+    parser.add_argument('--text', action='store_true', help='print the text plane after every frame')
+    parser.add_argument('--hash', action='store_true', help='print the hash of the mirrored shadow at the end')
+    args = parser.parse_args()
+
+    if stat.S_ISCHR(os.stat(args.source).st_mode):
+        stream = Stream(open_port(args.source, args.baud))
+    else:
+        stream = Stream(open(args.source, 'rb'))
+
+    image = None
+    frames = 0
+    total = 0
+    try:
+        while True:
+            header = sync(stream)
+            start = stream.count - HEADER.size
+            screen = Screen(header)
+            size = screen.vram_size + screen.cgram_end - screen.cgram_start
+            keyframe = header[1] == 0
+            if keyframe or image is None or len(image) != size:
+                image = bytearray(size)
+                synced = keyframe
+            if not decode(stream, image):
+                print('frame %5d overran the shadow, waiting for a keyframe' % header[2])
+                image = None
+                continue
+            if not synced:
+                continue
+            size = stream.count - start
+            frames += 1
+            total += size
+            print('frame %5d %-5s %6d bytes (%.1f bytes/frame)' %
+                  (header[2], 'key' if keyframe else 'delta', size, total / frames))
+            if args.pbm:
+                write_pbm(args.pbm, screen.render(image))
+            if args.text:
+                print('\n'.join(screen.text(image)))
+    except (EOFError, KeyboardInterrupt):
+        pass
+    if frames:
+        print('%d frames, %d bytes, %.1f bytes/frame' % (frames, total, total / frames))
+    if args.hash and image is not None:
+        print('shadow hash %08x' % fnv1a(image))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,89 @@
+#include <string.h>
+#include "AttributePlane.h"
+
+AttributePlane::AttributePlane(T6963C &lcd, ShadowVram &vram, int home) : _lcd(lcd), _vram(vram), _home(home)
+{
+    memset(&counters, 0, sizeof(counters));
+}
+
+// CG mode bit of the last MODE_SET
+static unsigned char cgMode(T6963C &lcd)
+{
+    int mode = lcd.cachedState(MODE_SET);
+
+    return mode < 0 ? MODE_INT_CG : mode & MODE_EXT_CG;
+}
+
+void AttributePlane::enable()
+{
+    union convIntByte conv;
+    int display;
+
+    _vram.fill(_home, ATTR_NORMAL, TEXT_PAGE_SIZE);
+    _vram.flush();
+
+    conv.iData = _home;
+    _lcd.dataWrite2Bytes(DISP_GRPH_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    _lcd.dataWrite2Bytes(DISP_GRPH_WIDTH, DISPLAY_WIDTH, 0);
+    _lcd.commandSet(MODE_SET + MODE_TEXT_ATTR + cgMode(_lcd));
+    // attributes are read through the graphics layer
+    display = _lcd.cachedState(ENA_BASE);
+    _lcd.commandSet(display < 0 ? ENA_BASE + ENA_TEXTGRPH : display | ENA_TEXTGRPH);
+}
+
+void AttributePlane::disable(unsigned char mode)
+{
+    // the whole graphics page: pixels drawn before enable() are still behind the plane
+    _vram.fill(_home, 0, GRPH_PAGE_SIZE);
+    _vram.flush();
+    _lcd.commandSet(MODE_SET + mode + cgMode(_lcd));
+}
+
+void AttributePlane::set(int x, int y, unsigned char attr, int length)
+{
+    if (length <= 0)
+        return;
+    counters.runs++;
+    counters.cells += length;
+    _vram.fill(addrOf(x, y), attr, length);
+}
+
+void AttributePlane::set(int x, int y, const unsigned char *attrs, int length)
+{
+    if (length <= 0)
+        return;
+    counters.runs++;
+    counters.cells += length;
+    _vram.write(addrOf(x, y), attrs, length);
+}
+
+void AttributePlane::modify(int x, int y, unsigned char clear, unsigned char set, int length)
+{
+    unsigned char attrs[DISPLAY_WIDTH];
+    int addr = addrOf(x, y), i, n;
+
+    if (length <= 0)
+        return;
+    counters.runs++;
+    counters.cells += length;
+    // through write(): cells that keep their value are not sent
+    for (; length > 0; addr += n, length -= n)
+    {
+        n = length < DISPLAY_WIDTH ? length : DISPLAY_WIDTH;
+        for (i = 0; i < n; i++)
+        {
+            attrs[i] = (_vram.read(addr + i) & ~clear) | set;
+        }
+        _vram.write(addr, attrs, n);
+    }
+}
+
+unsigned char AttributePlane::get(int x, int y)
+{
+    return _vram.read(addrOf(x, y));
+}
+
+void AttributePlane::flush()
+{
+    _vram.flush();
+}
@@ -0,0 +1,88 @@
+#ifndef ATTRIBUTE_PLANE_H
+#define ATTRIBUTE_PLANE_H
+
+#include "T6963C.h"
+#include "LcdLayout.h"
+#include "ShadowVram.h"
+
+/** Counters of an AttributePlane */
+struct AttributeCounters {
+    unsigned long runs;  // set() / modify() calls
+    unsigned long cells; // cells they covered
+};
+
+/** Per-cell text attributes (T6963C text attribute mode)
+ *
+ *  In MODE_TEXT_ATTR the graphics area holds one attribute byte per text
+ *  cell (ATTR_NORMAL, ATTR_REVERSE, ATTR_INHIBIT, plus ATTR_BLINK), laid
+ *  out like the text area. Highlighting a menu entry then costs one byte
+ *  per cell instead of a text or pixel rewrite, and the controller blinks
+ *  cells by itself, so alarms need no timer redraws. There is no graphics
+ *  layer while the plane is enabled.
+ *
+ *  Attributes are set per run of cells and go through the shadow, so a
+ *  run is one fill and flush() sends the changed bytes in merged bursts.
+ */
+class AttributePlane {
+  public:
+    /** Create an attribute plane
+     *
+     *  @param lcd Display the mode and graphics home are set on
+     *  @param vram Shadow the attributes are written through
+     *  @param home VRAM address of the plane (graphics home while enabled)
+     */
+    AttributePlane(T6963C &lcd, ShadowVram &vram, int home = VRAM_GRPH_ADDR);
+    virtual ~AttributePlane() {};
+
+    /** Clear the plane to ATTR_NORMAL and switch to text attribute mode
+     *
+     *  The plane is cleared before the mode changes, so old pixels never
+     *  show as attributes. The CG mode and cursor setting are kept.
+     */
+    void enable();
+
+    /** Blank the graphics page at the plane and return to a graphics mode
+     *
+     *  The whole page is cleared (GRPH_PAGE_SIZE bytes from home), not
+     *  only the attribute bytes; the shadow sends just what is not blank.
+     *
+     *  @param mode MODE_OR, MODE_EXOR or MODE_AND (the CG mode is kept)
+     */
+    void disable(unsigned char mode = MODE_OR);
+
+    /** Set a run of cells to one attribute
+     *
+     *  @param x Text column
+     *  @param y Text row
+     *  @param attr Attributes value
+     *  @param length Cells (a run continues on the next row)
+     */
+    void set(int x, int y, unsigned char attr, int length);
+
+    /** Set a run of cells to individual attributes */
+    void set(int x, int y, const unsigned char *attrs, int length);
+
+    /** Change bits of a run of cells: attr = (attr & ~clear) | set
+     *
+     *  e.g. modify(x, y, 0, ATTR_BLINK, n) starts an alarm blinking and
+     *  keeps its reverse or normal look.
+     */
+    void modify(int x, int y, unsigned char clear, unsigned char set, int length);
+
+    /** Attribute of one cell (from the shadow) */
+    unsigned char get(int x, int y);
+
+    /** Send the changed attributes */
+    void flush();
+
+    AttributeCounters counters;
+
+  private:
+    int addrOf(int x, int y) { return _home + y * DISPLAY_WIDTH + x; }
+
+    T6963C &_lcd;
+    ShadowVram &_vram;
+    int _home;
+};
+
+#endif
@@ -0,0 +1,61 @@
+#include <string.h>
+#include "BusTrace.h"
+
+#ifdef LCD_TRACE
+
+#define TRACE_VERSION 1
+
+BusTrace busTrace;
+
+BusTrace::BusTrace() : _clock(0), _ticksPerUs(1), _recorded(0)
+{
+}
+
+void BusTrace::setClock(uint32_t (*clock)(), uint32_t ticksPerUs)
+{
+    _clock = clock;
+    _ticksPerUs = ticksPerUs;
+}
+
+void BusTrace::clear()
+{
+    _recorded = 0;
+}
+
+static void put32(unsigned char *p, uint32_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+    p[2] = value >> 16;
+    p[3] = value >> 24;
+}
+
+void BusTrace::dump(void (*write)(const void *data, int length, void *context), void *context)
+{
+    unsigned char header[20], record[12];
+    uint32_t recorded = _recorded;
+    uint32_t kept = recorded < LCD_TRACE_SIZE ? recorded : LCD_TRACE_SIZE;
+    uint32_t i;
+
+    memcpy(header, "LTRC", 4);
+    put32(header + 4, TRACE_VERSION);
+    put32(header + 8, _ticksPerUs);
+    put32(header + 12, recorded);
+    put32(header + 16, kept);
+    write(header, sizeof(header), context);
+
+    for (i = recorded - kept; i != recorded; i++)
+    {
+        const TraceEvent &event = _events[i & (LCD_TRACE_SIZE - 1)];
+
+        put32(record, event.start);
+        put32(record + 4, event.duration);
+        record[8] = event.kind;
+        record[9] = event.arg;
+        record[10] = event.count;
+        record[11] = event.count >> 8;
+        write(record, sizeof(record), context);
+    }
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef BUS_TRACE_H
+#define BUS_TRACE_H
+
+#include <stdint.h>
+
+/** Kinds of traced bus operations */
+enum TraceKind {
+    TRACE_COMMAND,     // command byte, with its argument writes (arg = command)
+    TRACE_WRITE_BURST, // AUTO_WRITE / memoryFill burst (count = bytes)
+    TRACE_READ_BURST,  // AUTO_READ burst (count = bytes)
+    TRACE_STATUS_WAIT, // status poll loop (arg = TraceWait, count = polls)
+    TRACE_ROM_READ,    // blocking font ROM transaction (count = bytes)
+    TRACE_ROM_START,   // asynchronous font ROM transaction issued (count = bytes)
+    TRACE_KINDS
+};
+
+/** Status bit a TRACE_STATUS_WAIT loop waited for */
+enum TraceWait {
+    TRACE_WAIT_WRITE,
+    TRACE_WAIT_AUTO_WRITE,
+    TRACE_WAIT_AUTO_READ,
+};
+
+#ifdef LCD_TRACE
+
+#ifndef LCD_TRACE_SIZE
+#define LCD_TRACE_SIZE 1024 // events kept in RAM (power of 2)
+#endif
+static_assert((LCD_TRACE_SIZE & (LCD_TRACE_SIZE - 1)) == 0, "LCD_TRACE_SIZE must be a power of 2");
+
+/** One traced operation (12 bytes, also the dump record) */
+struct TraceEvent {
+    uint32_t start;    // clock ticks
+    uint32_t duration; // clock ticks
+    uint8_t kind;      // TraceKind
+    uint8_t arg;
+    uint16_t count;
+};
+
+/** Ring of the last LCD_TRACE_SIZE bus operations
+ *
+ *  Built only with -D LCD_TRACE; otherwise the TRACE_ macros below
+ *  expand to nothing and the driver carries no tracing code at all.
+ *  Events are recorded when an operation ends, so an enclosing operation
+ *  (a command and the status waits inside it) follows its children.
+ *
+ *  dump() writes a little-endian binary image for tracedump.py:
+ *  "LTRC", version, ticks per us, events recorded, events kept, then the
+ *  kept TraceEvent records oldest first.
+ */
+class BusTrace {
+  public:
+    BusTrace();
+
+    /** Set the time base
+     *
+     *  @param clock Free-running tick counter (wraps at 2^32)
+     *  @param ticksPerUs Ticks per microsecond
+     */
+    void setClock(uint32_t (*clock)(), uint32_t ticksPerUs);
+
+    uint32_t now() { return _clock ? _clock() : 0; }
+
+    void record(TraceKind kind, unsigned char arg, unsigned int count, uint32_t start)
+    {
+        TraceEvent &event = _events[_recorded++ & (LCD_TRACE_SIZE - 1)];
+
+        event.start = start;
+        event.duration = now() - start;
+        event.kind = kind;
+        event.arg = arg;
+        event.count = count > 0xFFFF ? 0xFFFF : count;
+    }
+
+    /** Forget all events */
+    void clear();
+
+    /** Write the binary image
+     *
+     *  @param write Output function (e.g. a serial port write)
+     *  @param context Passed to write
+     */
+    void dump(void (*write)(const void *data, int length, void *context), void *context);
+
+  private:
+    uint32_t (*_clock)();
+    uint32_t _ticksPerUs;
+    uint32_t _recorded;
+    TraceEvent _events[LCD_TRACE_SIZE];
+};
+
+extern BusTrace busTrace;
+
+#define TRACE_START(var) uint32_t var = busTrace.now()
+#define TRACE_RECORD(kind, arg, count, start) busTrace.record(kind, arg, count, start)
+
+#else
+
+#define TRACE_START(var)
+#define TRACE_RECORD(kind, arg, count, start) ((void)(count))
+
+#endif
+
+#endif
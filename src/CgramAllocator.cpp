@@ -0,0 +1,215 @@
+#include <string.h>
+#include "CgramAllocator.h"
+#include "Utf8Kuten.h"
+
+CgramAllocator::CgramAllocator(ShadowVram &vram, GlyphCache &glyphs) : _vram(vram), _glyphs(glyphs)
+{
+    int i;
+
+    _freeHead = -1;
+    _freeTail = -1;
+    for (i = 0; i < CGRAM_SLOTS; i++)
+    {
+        _slots[i].code = 0;
+        _slots[i].refs = 0;
+        _slots[i].valid = false;
+        pushFree(i);
+    }
+    memset(_owner, -1, sizeof(_owner));
+    memset(&counters, 0, sizeof(counters));
+}
+
+void CgramAllocator::unlinkFree(int slot)
+{
+    Slot &s = _slots[slot];
+
+    if (s.prev >= 0)
+        _slots[s.prev].next = s.next;
+    else
+        _freeHead = s.next;
+    if (s.next >= 0)
+        _slots[s.next].prev = s.prev;
+    else
+        _freeTail = s.prev;
+}
+
+void CgramAllocator::pushFree(int slot)
+{
+    Slot &s = _slots[slot];
+
+    s.prev = -1;
+    s.next = _freeHead;
+    if (_freeHead >= 0)
+        _slots[_freeHead].prev = slot;
+    _freeHead = slot;
+    if (_freeTail < 0)
+        _freeTail = slot;
+}
+
+unsigned char CgramAllocator::textCode(int slot)
+{
+    return CGRAM_FIRST_CODE + slot * 4;
+}
+
+int CgramAllocator::acquire(unsigned short code)
+{
+    int slot, width;
+
+    for (slot = 0; slot < CGRAM_SLOTS; slot++)
+    {
+        if (_slots[slot].valid && _slots[slot].code == code)
+        {
+            if (_slots[slot].refs++ == 0)
+                unlinkFree(slot);
+            counters.shared++;
+            return slot;
+        }
+    }
+
+    slot = _freeTail;
+    if (slot < 0)
+    {
+        counters.failures++;
+        return -1;
+    }
+    unlinkFree(slot);
+    if (_slots[slot].valid)
+        counters.evictions++;
+
+    _slots[slot].code = code;
+    _slots[slot].refs = 1;
+    _slots[slot].valid = true;
+    _vram.write(CGRAM_SLOT_ADDR + slot * 32, _glyphs.kuten(code, &width), 32);
+    // CG RAM is not cleared at startup: send the bytes that match the shadow too
+    _vram.markDirty(CGRAM_SLOT_ADDR + slot * 32, 32);
+    _slots[slot].width = width;
+    counters.uploads++;
+    return slot;
+}
+
+void CgramAllocator::release(int slot)
+{
+    if (slot < 0 || _slots[slot].refs == 0)
+        return;
+    if (--_slots[slot].refs == 0)
+        pushFree(slot);
+}
+
+void CgramAllocator::erase(int x, int y)
+{
+    int cell = y * DISPLAY_WIDTH + x;
+    unsigned char blank[2] = {0, 0};
+    int columns;
+
+    if (x < 0 || x >= DISPLAY_WIDTH || y < 0 || y >= DISPLAY_HEIGHT || _owner[cell] < 0)
+        return;
+    columns = _slots[_owner[cell]].width / 8;
+    release(_owner[cell]);
+    _owner[cell] = -1;
+    _vram.write(VRAM_TEXT_ADDR + cell, blank, columns);
+    _vram.write(VRAM_TEXT_ADDR + cell + DISPLAY_WIDTH, blank, columns);
+}
+
+// Erase every kanji with a cell in the columns [x, x + columns) of rows y and y + 1
+void CgramAllocator::eraseOverlapping(int x, int y, int columns)
+{
+    int ox, oy, owner;
+
+    for (oy = y - 1; oy <= y + 1; oy++)
+    {
+        for (ox = x - 1; ox < x + columns; ox++)
+        {
+            if (ox < 0 || ox >= DISPLAY_WIDTH || oy < 0 || oy >= DISPLAY_HEIGHT)
+                continue;
+            owner = _owner[oy * DISPLAY_WIDTH + ox];
+            // a half-width glyph to the left ends before x
+            if (owner >= 0 && ox + _slots[owner].width / 8 > x)
+                erase(ox, oy);
+        }
+    }
+}
+
+int CgramAllocator::putKanji(int x, int y, unsigned short code)
+{
+    int cell = y * DISPLAY_WIDTH + x;
+    unsigned char text[2];
+    int slot, columns;
+
+    // half-width glyphs (Ku 0) take one column
+    columns = code >> 8 ? 2 : 1;
+    if (x < 0 || x + columns > DISPLAY_WIDTH || y < 0 || y + 1 >= DISPLAY_HEIGHT)
+        return -1;
+    if (_owner[cell] >= 0 && _slots[_owner[cell]].code == code)
+        return _owner[cell];
+
+    // Acquire before releasing so an unchanged neighbour keeps its slot
+    slot = acquire(code);
+    eraseOverlapping(x, y, columns);
+    if (slot < 0)
+        return -1;
+
+    _owner[cell] = slot;
+    columns = _slots[slot].width / 8;
+    text[0] = textCode(slot);
+    text[1] = text[0] + 1;
+    _vram.write(VRAM_TEXT_ADDR + cell, text, columns);
+    text[0] += 2;
+    text[1] += 2;
+    _vram.write(VRAM_TEXT_ADDR + cell + DISPLAY_WIDTH, text, columns);
+    return slot;
+}
+
+int CgramAllocator::writeKanjiStr(int x, int y, const char *str)
+{
+    unsigned int i;
+    int drawn = 0;
+    unsigned short sjis;
+
+    for (i = 0; str[i] != 0 && str[i + 1] != 0 && x + 1 < DISPLAY_WIDTH; i += 2, x += 2)
+    {
+        sjis = ((unsigned char)str[i] << 8) | (unsigned char)str[i + 1];
+        if (putKanji(x, y, GT20L16J1Y_FONT::sjis_to_kuten(sjis)) >= 0)
+            drawn++;
+    }
+    return drawn;
+}
+
+int CgramAllocator::putChar(int x, int y, unsigned short code)
+{
+    unsigned char text;
+    int slot;
+
+    if (code >> 8 == 0 && code >= ' ' && code < 0x7F)
+    {
+        if (x < 0 || x >= DISPLAY_WIDTH || y < 0 || y + 1 >= DISPLAY_HEIGHT)
+            return 0;
+        eraseOverlapping(x, y, 1);
+        // character ROM codes are ASCII - 0x20, on the lower row like the
+        // lower half of a kanji
+        text = 0;
+        _vram.write(VRAM_TEXT_ADDR + y * DISPLAY_WIDTH + x, &text, 1);
+        text = code - ' ';
+        _vram.write(VRAM_TEXT_ADDR + (y + 1) * DISPLAY_WIDTH + x, &text, 1);
+        return 1;
+    }
+
+    slot = putKanji(x, y, code);
+    return slot < 0 ? 0 : _slots[slot].width / 8;
+}
+
+int CgramAllocator::writeUtf8Str(int x, int y, const char *str)
+{
+    unsigned short code;
+    int drawn = 0, columns;
+
+    for (str = utf8NextKuten(str, &code); code != 0; str = utf8NextKuten(str, &code))
+    {
+        columns = code >> 8 ? 2 : 1;
+        if (x + columns > DISPLAY_WIDTH)
+            break;
+        if (putChar(x, y, code) > 0)
+            drawn++;
+        x += columns;
+    }
+    return drawn;
+}
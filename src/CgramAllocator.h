@@ -0,0 +1,119 @@
+#ifndef CGRAM_ALLOCATOR_H
+#define CGRAM_ALLOCATOR_H
+
+#include "LcdLayout.h"
+#include "ShadowVram.h"
+#include "GlyphCache.h"
+
+#define CGRAM_FIRST_CODE 0x80                           // first CG RAM character code (internal CG mode)
+#define CGRAM_SLOTS ((0x100 - CGRAM_FIRST_CODE) / 4)    // 16x16 glyphs that fit in the codes 0x80-0xFF
+#define CGRAM_SLOT_ADDR (CGRAM_START + CGRAM_STORE_OFFSET) // CG RAM address of code 0x80
+
+/** Counters of a CgramAllocator */
+struct CgramCounters {
+    unsigned long uploads;   // glyphs written to CG RAM
+    unsigned long shared;    // acquires served by a resident glyph
+    unsigned long evictions; // free slots reused for another glyph
+    unsigned long failures;  // acquires with every slot in use
+};
+
+/** Maps 16x16 glyphs to 2x2 blocks of CG RAM characters
+ *
+ *  With the offset register at CGRAM_START >> 11, the character codes
+ *  0x80-0xFF of the text layer show CG RAM, which gives CGRAM_SLOTS
+ *  glyphs on screen at once. A glyph is uploaded once and shared by
+ *  reference count; slots whose count drops to zero keep their glyph and
+ *  are reused least recently released first. Kanji are then drawn as four
+ *  text bytes (UL UR on one row, LL LR below) instead of 32 graphics bytes.
+ *
+ *  Glyphs and text go to the shadow; call ShadowVram::flush() to send them.
+ */
+class CgramAllocator {
+  public:
+    /** Create an allocator
+     *
+     *  @param vram Shadow the glyphs and text codes are written to
+     *  @param glyphs Glyph source
+     */
+    CgramAllocator(ShadowVram &vram, GlyphCache &glyphs);
+    virtual ~CgramAllocator() {};
+
+    /** Get a slot holding a glyph, uploading it if needed
+     *
+     *  @param code Kuten code
+     *  @return slot number, or -1 if every slot is in use
+     */
+    int acquire(unsigned short code);
+
+    /** Drop one reference to a slot */
+    void release(int slot);
+
+    /** Text code of the upper-left cell of a slot (UR = +1, LL = +2, LR = +3) */
+    static unsigned char textCode(int slot);
+
+    /** Draw a kanji as four text cells
+     *
+     *  Kanji previously drawn with a cell under the new one are released
+     *  and blanked first. Half-width glyphs take one column (UL over LL).
+     *
+     *  @param x Text column of the upper-left cell
+     *  @param y Text row of the upper-left cell
+     *  @param code Kuten code
+     *  @return slot number, or -1 if no slot was available or the glyph
+     *          does not fit on the text page
+     */
+    int putKanji(int x, int y, unsigned short code);
+
+    /** Draw a character as two text rows
+     *
+     *  ASCII is written as a character ROM code on the lower row (the
+     *  upper row is blanked) and takes no CG RAM slot; other glyphs go
+     *  through putKanji().
+     *
+     *  @param x Text column
+     *  @param y Upper text row
+     *  @param code Kuten code
+     *  @return columns drawn (1 or 2), 0 if nothing was drawn
+     */
+    int putChar(int x, int y, unsigned short code);
+
+    /** Draw a Shift JIS string (2 bytes per character) as text
+     *
+     *  @return number of characters drawn
+     */
+    int writeKanjiStr(int x, int y, const char *str);
+
+    /** Draw a UTF-8 string (ASCII and JIS X 0208 mixed) with putChar()
+     *
+     *  @return number of characters drawn
+     */
+    int writeUtf8Str(int x, int y, const char *str);
+
+    /** Blank the kanji whose upper-left cell is at (x, y), if any */
+    void erase(int x, int y);
+
+    CgramCounters counters;
+
+  private:
+    struct Slot {
+        unsigned short code;
+        unsigned short refs;
+        unsigned char width; // 8 or 16
+        signed char prev; // free list (towards most recently released)
+        signed char next; // free list (towards least recently released)
+        bool valid;
+    };
+
+    void unlinkFree(int slot);
+    void pushFree(int slot);
+    void eraseOverlapping(int x, int y, int columns);
+
+    ShadowVram &_vram;
+    GlyphCache &_glyphs;
+    Slot _slots[CGRAM_SLOTS];
+    signed char _freeHead; // most recently released
+    signed char _freeTail; // least recently released, reused first
+    signed char _owner[DISPLAY_WIDTH * DISPLAY_HEIGHT];
+};
+
+#endif
@@ -0,0 +1,177 @@
+#include <string.h>
+#include "DisplayQueue.h"
+
+DisplayQueue::DisplayQueue(T6963C &lcd) : _lcd(lcd), _fence(0), _passed(0), _stalled(false)
+{
+    clearCounters();
+}
+
+void DisplayQueue::clearCounters()
+{
+    memset(&counters, 0, sizeof(counters));
+}
+
+void DisplayQueue::push(DisplayCommand &cmd)
+{
+    unsigned int queued;
+
+    counters.commands++;
+    if (!_queue.put(cmd))
+    {
+        counters.stalls++;
+        wakeWorker();
+        _stalled = true;
+        while (!_queue.put(cmd))
+        {
+            waitProgress();
+        }
+        _stalled = false;
+    }
+    queued = _queue.count();
+    if (queued > counters.maxDepth)
+        counters.maxDepth = queued;
+    wakeWorker();
+}
+
+void DisplayQueue::setAddress(int addr)
+{
+    DisplayCommand cmd;
+
+    cmd.op = OP_ADDR;
+    cmd.value = addr;
+    push(cmd);
+}
+
+void DisplayQueue::write(const unsigned char *data, int length)
+{
+    DisplayCommand cmd;
+    int n;
+
+    cmd.op = OP_WRITE;
+    while (length > 0)
+    {
+        n = length < DISPLAY_QUEUE_PAYLOAD ? length : DISPLAY_QUEUE_PAYLOAD;
+        cmd.length = n;
+        memcpy(cmd.data, data, n);
+        push(cmd);
+        data += n;
+        length -= n;
+    }
+}
+
+void DisplayQueue::write(int addr, const unsigned char *data, int length)
+{
+    setAddress(addr);
+    write(data, length);
+}
+
+void DisplayQueue::fill(int addr, unsigned char value, int length)
+{
+    DisplayCommand cmd;
+
+    cmd.op = OP_FILL;
+    cmd.value = addr;
+    cmd.length = length;
+    cmd.data[0] = value;
+    push(cmd);
+}
+
+void DisplayQueue::setRegister(unsigned char command, unsigned short value)
+{
+    DisplayCommand cmd;
+
+    cmd.op = OP_REGISTER;
+    cmd.command = command;
+    cmd.value = value;
+    push(cmd);
+}
+
+void DisplayQueue::command(unsigned char command)
+{
+    DisplayCommand cmd;
+
+    cmd.op = OP_COMMAND;
+    cmd.command = command;
+    push(cmd);
+}
+
+uint32_t DisplayQueue::fence()
+{
+    DisplayCommand cmd;
+
+    cmd.op = OP_FENCE;
+    cmd.fence = ++_fence;
+    counters.fences++;
+    push(cmd);
+    return cmd.fence;
+}
+
+bool DisplayQueue::done(uint32_t ticket)
+{
+    return (int32_t)(_passed.load(std::memory_order_acquire) - ticket) >= 0;
+}
+
+void DisplayQueue::wait(uint32_t ticket)
+{
+    if (done(ticket))
+        return;
+    counters.waits++;
+    while (!done(ticket))
+    {
+        waitProgress();
+    }
+}
+
+void DisplayQueue::flush()
+{
+    wait(fence());
+}
+
+unsigned int DisplayQueue::depth()
+{
+    return _queue.count();
+}
+
+int DisplayQueue::drain()
+{
+    DisplayCommand cmd;
+    int n = 0;
+
+    while (_queue.get(cmd))
+    {
+        run(cmd);
+        n++;
+        if (_stalled)
+            signalProgress();
+    }
+    counters.run += n;
+    if (n != 0)
+        counters.wakeups++;
+    return n;
+}
+
+void DisplayQueue::run(const DisplayCommand &cmd)
+{
+    switch (cmd.op)
+    {
+    case OP_ADDR:
+        _lcd.dataWrite2Bytes(REG_ADDR, cmd.value & 0xFF, cmd.value >> 8);
+        break;
+    case OP_WRITE:
+        _lcd.autoDataWrite(cmd.data, cmd.length);
+        break;
+    case OP_FILL:
+        _lcd.memoryFill(cmd.value, cmd.value + cmd.length, cmd.data[0]);
+        break;
+    case OP_REGISTER:
+        _lcd.dataWrite2Bytes(cmd.command, cmd.value & 0xFF, cmd.value >> 8);
+        break;
+    case OP_COMMAND:
+        _lcd.commandSet(cmd.command);
+        break;
+    case OP_FENCE:
+        _passed.store(cmd.fence, std::memory_order_release);
+        signalProgress();
+        break;
+    }
+}
@@ -0,0 +1,146 @@
+#ifndef DISPLAY_QUEUE_H
+#define DISPLAY_QUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+#include "T6963C.h"
+#include "EventRing.h"
+
+#ifndef DISPLAY_QUEUE_SIZE
+#define DISPLAY_QUEUE_SIZE 64 // queued commands (power of 2)
+#endif
+#define DISPLAY_QUEUE_PAYLOAD 32 // data bytes carried by one command
+
+/** Statistics of a DisplayQueue
+ *
+ *  commands to waits are written by the producer, run and wakeups by the
+ *  worker.
+ */
+struct DisplayQueueCounters {
+    unsigned long commands; // commands queued
+    unsigned long fences;   // fences queued
+    unsigned int maxDepth;  // deepest queue seen by the producer
+    unsigned long stalls;   // producer found the queue full
+    unsigned long waits;    // wait() calls that had to block
+    unsigned long run;      // commands executed
+    unsigned long wakeups;  // drain() calls that found work
+};
+
+/** One queued display operation */
+struct DisplayCommand {
+    unsigned char op;      // DisplayQueue::Op
+    unsigned char command; // T6963C command byte
+    unsigned short value;  // address, register value or fill length
+    unsigned short length; // payload bytes / fill length
+    uint32_t fence;        // fence number (OP_FENCE)
+    unsigned char data[DISPLAY_QUEUE_PAYLOAD];
+};
+
+/** T6963C command queue drained by a display thread
+ *
+ *  The producer (one application thread) queues address, burst write,
+ *  fill, register and mode commands and returns at once; the worker
+ *  thread owns the T6963C and does all the status polling. Writes longer
+ *  than DISPLAY_QUEUE_PAYLOAD are split into consecutive bursts. fence()
+ *  returns a ticket that done()/wait() check, so a caller can wait for one
+ *  frame without draining everything queued after it.
+ *
+ *  The queue itself is a lock-free SPSC ring; derived classes only
+ *  provide the thread and the wake-ups (MbedDisplayQueue on rtos::Thread,
+ *  HostDisplayQueue on std::thread). Use the T6963C directly only before
+ *  the thread starts or after flush().
+ */
+class DisplayQueue {
+  public:
+    enum Op {
+        OP_ADDR,     // REG_ADDR
+        OP_WRITE,    // AUTO_WRITE burst at the address pointer
+        OP_FILL,     // memoryFill
+        OP_REGISTER, // dataWrite2Bytes
+        OP_COMMAND,  // commandSet (mode set, display enable, cursor)
+        OP_FENCE,
+    };
+
+    /** Create a queue in front of a display
+     *
+     *  @param lcd Display the worker writes to
+     */
+    DisplayQueue(T6963C &lcd);
+    virtual ~DisplayQueue() {};
+
+    /** Set the address pointer */
+    void setAddress(int addr);
+
+    /** Write bytes at the address pointer (auto increment) */
+    void write(const unsigned char *data, int length);
+
+    /** Write bytes at a VRAM address */
+    void write(int addr, const unsigned char *data, int length);
+
+    /** Fill [addr, addr + length) with a value */
+    void fill(int addr, unsigned char value, int length);
+
+    /** Set a two byte register (REG_OFFSET, DISP_TEXT_HOME_ADDR, ...)
+     *
+     *  @param command T6963C command
+     *  @param value Register value, low byte first on the bus
+     */
+    void setRegister(unsigned char command, unsigned short value);
+
+    /** Send a command without data (MODE_SET, ENA_BASE, CURSOR_BASE) */
+    void command(unsigned char command);
+
+    /** Queue a fence
+     *
+     *  @return Ticket that is done once everything queued before it ran
+     */
+    uint32_t fence();
+
+    /** true if a fence has been passed by the worker */
+    bool done(uint32_t ticket);
+
+    /** Block until a fence has been passed by the worker */
+    void wait(uint32_t ticket);
+
+    /** Block until everything queued so far ran */
+    void flush();
+
+    /** Queued commands (snapshot) */
+    unsigned int depth();
+
+    /** Run queued commands until the queue is empty (worker thread)
+     *
+     *  @return Number of commands run
+     */
+    int drain();
+
+    void clearCounters();
+
+    DisplayQueueCounters counters;
+
+  protected:
+    /** Producer: commands were queued */
+    virtual void wakeWorker() = 0;
+
+    /** Producer: sleep until the worker signals progress
+     *
+     *  Must also return after a short timeout (about 1ms), so a signal sent
+     *  just before the producer started waiting is never lost.
+     */
+    virtual void waitProgress() = 0;
+
+    /** Worker: a fence passed or queue space was freed */
+    virtual void signalProgress() = 0;
+
+  private:
+    void push(DisplayCommand &cmd);
+    void run(const DisplayCommand &cmd);
+
+    T6963C &_lcd;
+    EventRing<DisplayCommand, DISPLAY_QUEUE_SIZE> _queue;
+    uint32_t _fence;                // last ticket handed out (producer)
+    std::atomic<uint32_t> _passed;  // last fence run (worker)
+    std::atomic<bool> _stalled;     // producer waits for space
+};
+
+#endif
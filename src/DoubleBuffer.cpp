@@ -0,0 +1,50 @@
+#include <string.h>
+#include "DoubleBuffer.h"
+
+DoubleBuffer::DoubleBuffer(T6963C &lcd, ShadowVram &vram, bool flipText)
+    : _lcd(lcd), _vram(vram), _flipText(flipText), _front(0)
+{
+    memset(_graphics, 0, sizeof(_graphics));
+    memset(_text, 0, sizeof(_text));
+    memset(&counters, 0, sizeof(counters));
+}
+
+unsigned char *DoubleBuffer::graphics()
+{
+    return _graphics;
+}
+
+unsigned char *DoubleBuffer::text()
+{
+    return _flipText ? _text : 0;
+}
+
+int DoubleBuffer::frontPage()
+{
+    return _front;
+}
+
+void DoubleBuffer::present()
+{
+    union convIntByte conv;
+    unsigned long sent = _vram.counters.bytes;
+    int back = _front ^ 1;
+
+    // the shadow only marks bytes that differ from the back page
+    _vram.write(VRAM_GRPH_PAGE(back), _graphics, GRPH_PAGE_SIZE);
+    if (_flipText)
+        _vram.write(VRAM_TEXT_PAGE(back), _text, TEXT_PAGE_SIZE);
+    _vram.flush();
+
+    conv.iData = VRAM_GRPH_PAGE(back);
+    _lcd.dataWrite2Bytes(DISP_GRPH_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    if (_flipText)
+    {
+        conv.iData = VRAM_TEXT_PAGE(back);
+        _lcd.dataWrite2Bytes(DISP_TEXT_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    }
+    _front = back;
+
+    counters.frames++;
+    counters.bytes += _vram.counters.bytes - sent;
+}
@@ -0,0 +1,56 @@
+#ifndef DOUBLE_BUFFER_H
+#define DOUBLE_BUFFER_H
+
+#include "T6963C.h"
+#include "LcdLayout.h"
+#include "ShadowVram.h"
+
+/** Counters of DoubleBuffer::present() */
+struct DoubleBufferCounters {
+    unsigned long frames;
+    unsigned long bytes; // bytes sent to the back pages (from the shadow)
+};
+
+/** Tear-free frames by flipping between the VRAM pages of LcdLayout.h
+ *
+ *  The application draws the next frame into RAM (graphics(), and text()
+ *  if text is flipped too). present() copies it into the page that is not
+ *  shown through the shadow, so only bytes that differ from what that page
+ *  held two frames ago are sent, then shows it with one home address
+ *  command per layer. Nothing partially drawn is ever on screen.
+ */
+class DoubleBuffer {
+  public:
+    /** Create a double buffer; page 0 is assumed to be shown
+     *
+     *  @param lcd Display the home addresses are set on
+     *  @param vram Shadow the back pages are written through
+     *  @param flipText true to flip the text layer as well
+     */
+    DoubleBuffer(T6963C &lcd, ShadowVram &vram, bool flipText = false);
+    virtual ~DoubleBuffer() {};
+
+    /** Graphics frame being drawn (GRPH_PAGE_SIZE bytes, DISPLAY_WIDTH per line) */
+    unsigned char *graphics();
+
+    /** Text frame being drawn (TEXT_PAGE_SIZE codes); NULL unless flipText */
+    unsigned char *text();
+
+    /** Send the frame to the back page and show it */
+    void present();
+
+    /** Page currently shown (0 or 1) */
+    int frontPage();
+
+    DoubleBufferCounters counters;
+
+  private:
+    T6963C &_lcd;
+    ShadowVram &_vram;
+    bool _flipText;
+    int _front;
+    unsigned char _graphics[GRPH_PAGE_SIZE];
+    unsigned char _text[TEXT_PAGE_SIZE];
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef EVENT_RING_H
+#define EVENT_RING_H
+
+#include <atomic>
+
+/** Lock-free single-producer/single-consumer ring buffer
+ *
+ *  put() is called from exactly one context (e.g. a timer ISR) and get()
+ *  from exactly one other (the main loop). Neither blocks nor masks
+ *  interrupts: the indexes are free-running counters published with
+ *  release/acquire ordering, so all N slots are usable. A put() into a full
+ *  ring drops the item and returns false.
+ */
+template <typename T, unsigned int N>
+class EventRing {
+    static_assert(N != 0 && (N & (N - 1)) == 0, "EventRing size must be a power of 2");
+
+  public:
+    EventRing() : _head(0), _tail(0) {};
+
+    /** Queue an item (producer side)
+     *
+     *  @return false if the ring was full
+     */
+    bool put(const T &item)
+    {
+        unsigned int head = _head.load(std::memory_order_relaxed);
+
+        if (head - _tail.load(std::memory_order_acquire) == N)
+            return false;
+        _items[head & (N - 1)] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Take the oldest item (consumer side)
+     *
+     *  @return false if the ring was empty
+     */
+    bool get(T &item)
+    {
+        unsigned int tail = _tail.load(std::memory_order_relaxed);
+
+        if (_head.load(std::memory_order_acquire) == tail)
+            return false;
+        item = _items[tail & (N - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Number of queued items (a snapshot when called from either side) */
+    unsigned int count() const
+    {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+  private:
+    std::atomic<unsigned int> _head; // next slot to write (producer)
+    std::atomic<unsigned int> _tail; // next slot to read (consumer)
+    T _items[N];
+};
+
+#endif
@@ -0,0 +1,145 @@
+#include <string.h>
+#include "FillEngine.h"
+
+FillEngine::FillEngine(T6963C &lcd, ShadowVram *vram)
+    : _lcd(lcd), _vram(vram), _pattern(0), _runStart(-1), _runEnd(-1), _runGaps(0)
+{
+    memset(&counters, 0, sizeof(counters));
+}
+
+void FillEngine::fill(int from, int to, uint16_t pattern)
+{
+    fillRect(from, 0, 0, 0, to - from, 1, pattern);
+}
+
+void FillEngine::fillRect(int home, int stride, int x, int y, int width, int height, uint16_t pattern)
+{
+    unsigned char value;
+    int addr, row, i;
+
+    counters.regions++;
+    _pattern = pattern;
+    for (row = 0; row < height; row++)
+    {
+        addr = home + (y + row) * stride + x;
+        for (i = 0; i < width; i++, addr++)
+        {
+            value = patternAt(addr);
+            if (_vram != NULL && ShadowVram::contains(addr))
+            {
+                if (!_vram->dirty(addr) && _vram->read(addr) == value)
+                {
+                    counters.skipped++;
+                    continue;
+                }
+                // dirty until the run is sent
+                _vram->fill(addr, value, 1);
+            }
+            need(addr);
+        }
+    }
+    emit();
+}
+
+void FillEngine::fillText(int x, int y, int width, int height, unsigned char code)
+{
+    fillRect(VRAM_TEXT_ADDR, DISPLAY_WIDTH, x, y, width, height, FILL_BYTE(code));
+}
+
+void FillEngine::fillGraphics(int x, int y, int width, int height, uint16_t pattern)
+{
+    fillRect(VRAM_GRPH_ADDR, DISPLAY_WIDTH, x, y, width, height, pattern);
+}
+
+// What a run sends at addr: the shadow already holds the pattern for the
+// filled bytes and the current contents for the gaps
+unsigned char FillEngine::dataAt(int addr)
+{
+    if (_vram != NULL && ShadowVram::contains(addr))
+        return _vram->read(addr);
+    return patternAt(addr);
+}
+
+// The bytes [from, to) between two runs can be resent as they are
+bool FillEngine::joinable(int from, int to)
+{
+    if (from == to)
+        return true;
+    if (_vram == NULL || to - from > FILL_MERGE_GAP)
+        return false;
+    for (; from < to; from++)
+    {
+        if (!ShadowVram::contains(from))
+            return false;
+    }
+    return true;
+}
+
+// Add a byte that has to be written (addresses ascending)
+void FillEngine::need(int addr)
+{
+    if (_runStart >= 0)
+    {
+        if (joinable(_runEnd, addr))
+        {
+            _runGaps += addr - _runEnd;
+            _runEnd = addr + 1;
+            return;
+        }
+        emit();
+    }
+    _runStart = addr;
+    _runEnd = addr + 1;
+    _runGaps = 0;
+}
+
+// Write the pending run
+void FillEngine::emit()
+{
+    union convIntByte conv;
+    unsigned char chunk[FILL_CHUNK];
+    int addr, length, n, i;
+
+    if (_runStart < 0)
+        return;
+    length = _runEnd - _runStart;
+    counters.gapBytes += _runGaps;
+
+    if (length <= FILL_SINGLE_MAX)
+    {
+        conv.iData = _runStart;
+        _lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+        for (addr = _runStart; addr < _runEnd; addr++)
+        {
+            _lcd.dataWriteByte(DATA_WRITE_UP, dataAt(addr));
+        }
+        counters.singles += length;
+    }
+    else if (_runGaps == 0 && (_pattern & 0xFF) == (_pattern >> 8))
+    {
+        _lcd.memoryFill(_runStart, _runEnd, _pattern);
+        counters.bursts++;
+        counters.burstBytes += length;
+    }
+    else
+    {
+        // one burst: the driver continues it across the chunks
+        conv.iData = _runStart;
+        _lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+        for (addr = _runStart; addr < _runEnd; addr += n)
+        {
+            n = _runEnd - addr < FILL_CHUNK ? _runEnd - addr : FILL_CHUNK;
+            for (i = 0; i < n; i++)
+            {
+                chunk[i] = dataAt(addr + i);
+            }
+            _lcd.autoDataWrite(chunk, n);
+        }
+        counters.bursts++;
+        counters.burstBytes += length;
+    }
+
+    if (_vram != NULL)
+        _vram->markClean(_runStart, length);
+    _runStart = -1;
+}
@@ -0,0 +1,95 @@
+#ifndef FILL_ENGINE_H
+#define FILL_ENGINE_H
+
+#include <stdint.h>
+#include "T6963C.h"
+#include "LcdLayout.h"
+#include "ShadowVram.h"
+
+#ifndef FILL_SINGLE_MAX
+#define FILL_SINGLE_MAX 1 // runs up to this long use DATA_WRITE_UP instead of an AUTO_WRITE burst
+#endif
+#ifndef FILL_MERGE_GAP
+#define FILL_MERGE_GAP 5 // known bytes resent to join two runs (AUTO_RESET + REG_ADDR + AUTO_WRITE)
+#endif
+#define FILL_CHUNK 32 // bytes staged per autoDataWrite() of a patterned run
+
+/** 16-bit fill pattern of a single byte value */
+#define FILL_BYTE(value) ((uint16_t)((value) * 0x0101))
+
+/** Counters of a FillEngine */
+struct FillCounters {
+    unsigned long regions;    // fill calls
+    unsigned long skipped;    // bytes the shadow knew already held the pattern
+    unsigned long bursts;     // AUTO_WRITE runs
+    unsigned long burstBytes; // bytes in them (gaps included)
+    unsigned long singles;    // bytes written with DATA_WRITE_UP
+    unsigned long gapBytes;   // known bytes resent to join runs
+};
+
+/** Linear and rectangular fills with byte or 16-bit patterns
+ *
+ *  A pattern puts its low byte at even and its high byte at odd
+ *  addresses, so neighbouring fills tile (FILL_BYTE(v) for a plain
+ *  value). Rectangles are in bytes of a plane with a row stride: text
+ *  cells, or 8 pixel columns by pixel lines of the graphics area.
+ *
+ *  With a ShadowVram, bytes the shadow knows the display already holds
+ *  (clean and equal to the pattern) are skipped, and runs separated by at
+ *  most FILL_MERGE_GAP known bytes, including the bytes between the rows
+ *  of a rectangle, are joined into one burst that resends the known
+ *  bytes. Each remaining run is written the cheapest way: DATA_WRITE_UP
+ *  for up to FILL_SINGLE_MAX bytes, memoryFill() for a uniform run and
+ *  staged autoDataWrite() chunks for a patterned one. The shadow is left
+ *  in sync. Without a shadow every byte is written, full width rectangles
+ *  as a single burst.
+ */
+class FillEngine {
+  public:
+    /** Create a fill engine
+     *
+     *  @param lcd Display to write to
+     *  @param vram Shadow of the display (NULL: nothing is known)
+     */
+    FillEngine(T6963C &lcd, ShadowVram *vram = 0);
+    virtual ~FillEngine() {};
+
+    /** Fill [from, to) with a pattern */
+    void fill(int from, int to, uint16_t pattern);
+
+    /** Fill a rectangle of a plane
+     *
+     *  @param home VRAM address of the plane
+     *  @param stride Bytes per row of the plane
+     *  @param x First byte of each row
+     *  @param y First row
+     *  @param width Bytes per row
+     *  @param height Rows
+     *  @param pattern Fill pattern
+     */
+    void fillRect(int home, int stride, int x, int y, int width, int height, uint16_t pattern);
+
+    /** Fill text cells of the first text page with a character code */
+    void fillText(int x, int y, int width, int height, unsigned char code = 0);
+
+    /** Fill the first graphics page: x and width in bytes (8 pixels), y and height in pixel lines */
+    void fillGraphics(int x, int y, int width, int height, uint16_t pattern = 0);
+
+    FillCounters counters;
+
+  private:
+    unsigned char patternAt(int addr) { return addr & 1 ? _pattern >> 8 : _pattern; }
+    unsigned char dataAt(int addr);
+    bool joinable(int from, int to);
+    void need(int addr);
+    void emit();
+
+    T6963C &_lcd;
+    ShadowVram *_vram;
+    uint16_t _pattern;
+    int _runStart; // pending run [_runStart, _runEnd), -1 = none
+    int _runEnd;
+    int _runGaps;  // known bytes in it
+};
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef FONT_ROM_PORT_H
+#define FONT_ROM_PORT_H
+
+#include <stdint.h>
+#include "BusTrace.h"
+
+#define FONT_ROM_ASYNC_MAX 32 // longest startRead() (one 16x16 glyph)
+
+/** Transaction counters of a font ROM port */
+struct FontRomCounters {
+    unsigned long transactions; // CS-asserted 0x03 reads
+    unsigned long bytes;        // data bytes clocked out of the ROM
+};
+
+/** Serial port of a GT20L16J1Y font ROM
+ *
+ *  One read() is one chip-select cycle: the 0x03 command, a 24-bit address
+ *  and `length` data bytes. startRead() issues the same cycle without
+ *  waiting for it; ports without asynchronous transfers complete it before
+ *  returning.
+ */
+class FontRomPort {
+  public:
+    FontRomPort() { clearCounters(); };
+    virtual ~FontRomPort() {};
+
+    /** Read consecutive bytes from the ROM
+     *
+     *  @param address ROM byte address
+     *  @param data Destination buffer
+     *  @param length Number of bytes to read
+     */
+    void read(uint32_t address, unsigned char *data, int length)
+    {
+        TRACE_START(traceStart);
+        counters.transactions++;
+        counters.bytes += length;
+        doRead(address, data, length);
+        TRACE_RECORD(TRACE_ROM_READ, 0, length, traceStart);
+    }
+
+    /** Start reading consecutive bytes from the ROM
+     *
+     *  `data` must stay valid until busy() returns false.
+     *
+     *  @param address ROM byte address
+     *  @param data Destination buffer
+     *  @param length Number of bytes to read (up to FONT_ROM_ASYNC_MAX)
+     */
+    void startRead(uint32_t address, unsigned char *data, int length)
+    {
+        TRACE_START(traceStart);
+        counters.transactions++;
+        counters.bytes += length;
+        doStartRead(address, data, length);
+        TRACE_RECORD(TRACE_ROM_START, 0, length, traceStart);
+    }
+
+    /** true while a transfer started by startRead() is running */
+    virtual bool busy() { return false; }
+
+    /** Wait for the transfer started by startRead() */
+    virtual void waitIdle()
+    {
+        while (busy())
+        {
+        }
+    }
+
+    void clearCounters()
+    {
+        counters.transactions = 0;
+        counters.bytes = 0;
+    }
+
+    FontRomCounters counters;
+
+  protected:
+    virtual void doRead(uint32_t address, unsigned char *data, int length) = 0;
+    virtual void doStartRead(uint32_t address, unsigned char *data, int length)
+    {
+        doRead(address, data, length);
+    }
+};
+
+#endif
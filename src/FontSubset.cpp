@@ -0,0 +1,21 @@
+#include <stddef.h>
+#include "FontSubset.h"
+
+const unsigned char *fontSubsetFind(unsigned short code, int *width)
+{
+    unsigned int low = 0, high = fontSubsetCount, mid;
+
+    while (low < high)
+    {
+        mid = (low + high) / 2;
+        if (fontSubsetCodes[mid] < code)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    if (low == fontSubsetCount || fontSubsetCodes[low] != code)
+        return NULL;
+    if (width)
+        *width = fontSubsetWidths[low];
+    return fontSubsetGlyphs[low];
+}
@@ -0,0 +1,18 @@
+#ifndef FONT_SUBSET_H
+#define FONT_SUBSET_H
+
+/* Flash-resident glyph subset generated by fontsubset.py (FontSubsetData.cpp) */
+extern const unsigned int fontSubsetCount;
+extern const unsigned short fontSubsetCodes[];   // Kuten codes, ascending
+extern const unsigned char fontSubsetWidths[];   // 8 or 16
+extern const unsigned char fontSubsetGlyphs[][32]; // CGRAM layout (UL, UR, LL, LR)
+
+/** Look a glyph up in the flash subset
+ *
+ *  @param code Kuten code ([15:8] Ku, [7:0] Ten)
+ *  @param width Set to the font width (8 or 16) if found and not NULL
+ *  @return 32 bytes in CGRAM layout, or NULL if the glyph is not in the subset
+ */
+const unsigned char *fontSubsetFind(unsigned short code, int *width);
+
+#endif
@@ -1,9 +1,20 @@
+#ifndef GT20L16J1Y_FONT_H
+#define GT20L16J1Y_FONT_H
+
+#include "FontRomPort.h"
+
+#define READ_MANY_MAX 32    // codes sorted together by read_many() (longer lists are read in chunks)
+#define READ_MANY_BURST 512 // longest single ROM transaction of read_many()
+#define READ_MANY_GAP 8     // unused bytes read rather than starting a new transaction
+#ifndef LCD_HOST_BUILD
 #include "mbed.h"
+#include "mbed/MbedFontRomPort.h"
+#endif
 
 class GT20L16J1Y_FONT {
   public:
+#ifndef LCD_HOST_BUILD
     GT20L16J1Y_FONT();
-    virtual ~GT20L16J1Y_FONT() {};
     
     /** Create a GT20L16J1Y font ROM connected to the specified pins
      *
@@ -13,6 +24,14 @@ class GT20L16J1Y_FONT {
      *  @param cs Chip enable input pin to connect to
      */
     GT20L16J1Y_FONT(PinName mosi, PinName miso, PinName sclk, PinName cs);
+#endif
+
+    /** Create a GT20L16J1Y font ROM on an existing port
+     *
+     *  @param port Font ROM port (e.g. the host simulator)
+     */
+    GT20L16J1Y_FONT(FontRomPort &port);
+    virtual ~GT20L16J1Y_FONT();
 
     /** Read font data from SJIS code
      *
@@ -27,9 +46,61 @@ class GT20L16J1Y_FONT {
      */
     int read_kuten(unsigned short code);
 
+    /** Read font data of several Ku-Ten codes in as few transactions as possible
+     *
+     *  Codes are deduplicated and sorted by ROM address; glyphs that are
+     *  adjacent (or less than READ_MANY_GAP bytes apart) in the ROM are read
+     *  in one CS-asserted burst and scattered back in the given order.
+     *  Lists longer than READ_MANY_MAX are read in chunks of READ_MANY_MAX
+     *  codes, each sorted on its own.
+     *
+     *  @param codes Kuten codes ([15:8] Ku, [7:0] Ten)
+     *  @param count Number of codes
+     *  @param bitmaps count * 32 bytes destination, glyph i at bitmaps + 32 * i
+     *  @param widths Set to the font widths (8 or 16) if not NULL
+     *  @return number of ROM transactions
+     */
+    int read_many(const unsigned short *codes, int count, unsigned char *bitmaps, int *widths = 0);
+
+    /** Start reading font data from Ku-Ten code without blocking
+     *
+     *  The glyph lands in `buffer` (not in bitmap) once busy() is false, so
+     *  the next glyph can be fetched while the previous one is drawn.
+     *
+     *  @param code Japanese Kanji font code (Kuten code [15:8] Ku, [7:0] Ten)
+     *  @param buffer 32 bytes destination, valid until busy() returns false
+     *  @return font width (8 or 16)
+     */
+    int read_kuten_async(unsigned short code, unsigned char *buffer);
+
+    /** true while a read_kuten_async() transfer is running */
+    bool busy();
+
+    /** Wait for the read_kuten_async() transfer */
+    void wait();
+
+    /** ROM address of a glyph
+     *
+     *  @param code Kuten code ([15:8] Ku, [7:0] Ten)
+     *  @param width Set to the font width (8 or 16)
+     *  @return byte address of the glyph in the ROM
+     */
+    static uint32_t kuten_address(unsigned short code, int *width);
+
+    /** Convert SJIS code to Ku-Ten code
+     *
+     *  @param code Shift JIS code
+     *  @return Kuten code ([15:8] Ku, [7:0] Ten)
+     */
+    static unsigned short sjis_to_kuten(unsigned short code);
+
     unsigned char bitmap[32];
 
   private:
-    SPI _spi;
-    DigitalOut _CS;
+    int read_chunk(const unsigned short *codes, int count, unsigned char *bitmaps, int *widths);
+
+    FontRomPort *_ownPort;
+    FontRomPort &_port;
 };
+
+#endif
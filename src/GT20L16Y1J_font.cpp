@@ -1,22 +1,30 @@
-#include "mbed.h"
+#include <stddef.h>
+#include <string.h>
 #include "GT20L16J1Y_font.h"
 
+#ifndef LCD_HOST_BUILD
 #if defined(TARGET_LPC1768)
-GT20L16J1Y_FONT::GT20L16J1Y_FONT() : _spi(p11, p12, p13), _CS(p10) {
+GT20L16J1Y_FONT::GT20L16J1Y_FONT() : _ownPort(new MbedFontRomPort(p11, p12, p13, p10)), _port(*_ownPort) {
 }
 #endif
 
-GT20L16J1Y_FONT::GT20L16J1Y_FONT(PinName mosi, PinName miso, PinName sclk, PinName cs) : _spi(mosi, miso, sclk, NC), _CS(cs)
+GT20L16J1Y_FONT::GT20L16J1Y_FONT(PinName mosi, PinName miso, PinName sclk, PinName cs) : _ownPort(new MbedFontRomPort(mosi, miso, sclk, cs)), _port(*_ownPort)
 {
-    // Setup the spi for 8 bit data, high steady state clock
-    _spi.format(8,3);
-    _spi.frequency(10000000);
 }   
+#endif
 
-int GT20L16J1Y_FONT::read_kuten(unsigned short code) {
+GT20L16J1Y_FONT::GT20L16J1Y_FONT(FontRomPort &port) : _ownPort(NULL), _port(port)
+{
+}
+
+GT20L16J1Y_FONT::~GT20L16J1Y_FONT()
+{
+    delete _ownPort;
+}
+
+uint32_t GT20L16J1Y_FONT::kuten_address(unsigned short code, int *width) {
     unsigned char MSB, LSB;
     uint32_t address;
-    int ret;
     
     MSB = (code & 0xFF00) >> 8;
     LSB = code & 0x00FF;
@@ -35,41 +43,114 @@ int GT20L16J1Y_FONT::read_kuten(unsigned short code) {
     else if(MSB == 0 && LSB >= 0x20 && LSB <= 0x7F)
         address = (LSB - 0x20)*16 + 255968;
     
-    // Deselect the device
-    _CS = 1;
+    if(MSB == 0 && LSB >= 0x20 && LSB <= 0x7F)
+        *width = 8;
+    else
+        *width = 16;
     
-    // Select the device by seting chip select low
-    _CS = 0;
-    _spi.write(0x03);    // Read data byte
-    _spi.write(address>>16 & 0xff);
-    _spi.write(address>>8 & 0xff);
-    _spi.write(address & 0xff);
+    return address;
+}
+
+int GT20L16J1Y_FONT::read_kuten(unsigned short code) {
+    uint32_t address;
+    int ret;
     
-    if(MSB == 0 && LSB >= 0x20 && LSB <= 0x7F) {
-        for(int i=0; i<16; i++)
-        {
-            bitmap[i] = _spi.write(0x00);
-        }
-        ret = 8;
+    address = kuten_address(code, &ret);
+    _port.read(address, bitmap, ret * 2);
+    
+    return ret;
+}
+
+int GT20L16J1Y_FONT::read_kuten_async(unsigned short code, unsigned char *buffer) {
+    uint32_t address;
+    int ret;
+    
+    address = kuten_address(code, &ret);
+    _port.startRead(address, buffer, ret * 2);
+    
+    return ret;
+}
+
+int GT20L16J1Y_FONT::read_many(const unsigned short *codes, int count, unsigned char *bitmaps, int *widths) {
+    int transactions = 0;
+    
+    // READ_MANY_MAX codes are sorted at a time
+    for(; count > READ_MANY_MAX; count -= READ_MANY_MAX) {
+        transactions += read_chunk(codes, READ_MANY_MAX, bitmaps, widths);
+        codes += READ_MANY_MAX;
+        bitmaps += 32 * READ_MANY_MAX;
+        if(widths)
+            widths += READ_MANY_MAX;
     }
-    else {
-        for(int i=0; i<32; i++)
-        {
-            bitmap[i] = _spi.write(0x00);
+    if(count > 0)
+        transactions += read_chunk(codes, count, bitmaps, widths);
+    return transactions;
+}
+
+int GT20L16J1Y_FONT::read_chunk(const unsigned short *codes, int count, unsigned char *bitmaps, int *widths) {
+    uint32_t address[READ_MANY_MAX];
+    int width[READ_MANY_MAX];
+    int order[READ_MANY_MAX];
+    unsigned char burst[READ_MANY_BURST];
+    uint32_t start, end;
+    int i, j, first, last, key, transactions;
+    
+    // Sort by ROM address (insertion sort, count is small)
+    for(i=0; i<count; i++) {
+        address[i] = kuten_address(codes[i], &width[i]);
+        if(widths)
+            widths[i] = width[i];
+        key = i;
+        for(j=i; j>0 && address[order[j-1]] > address[key]; j--)
+            order[j] = order[j-1];
+        order[j] = key;
+    }
+    
+    transactions = 0;
+    for(first=0; first<count; first=last) {
+        // Extend the burst while the next glyph is close enough and fits
+        start = address[order[first]];
+        end = start + width[order[first]] * 2;
+        for(last=first+1; last<count; last++) {
+            uint32_t next = address[order[last]];
+            uint32_t nextEnd = next + width[order[last]] * 2;
+            if(next > end + READ_MANY_GAP)
+                break;
+            if(nextEnd > end) {
+                if(nextEnd - start > READ_MANY_BURST)
+                    break;
+                end = nextEnd;
+            }
+        }
+        
+        _port.read(start, burst, end - start);
+        transactions++;
+        
+        // Scatter (duplicates share the same bytes)
+        for(i=first; i<last; i++) {
+            key = order[i];
+            memcpy(bitmaps + 32 * key, burst + (address[key] - start), width[key] * 2);
         }
-        ret = 16;
     }
-
-    // Deselect the device
-    _CS = 1;
     
-    return ret;
+    return transactions;
+}
+
+bool GT20L16J1Y_FONT::busy() {
+    return _port.busy();
+}
+
+void GT20L16J1Y_FONT::wait() {
+    _port.waitIdle();
 }
 
 void GT20L16J1Y_FONT::read(unsigned short code) {
+    read_kuten(sjis_to_kuten(code));
+}
+
+unsigned short GT20L16J1Y_FONT::sjis_to_kuten(unsigned short code) {
     unsigned char c1, c2, MSB, LSB;
     uint32_t seq;
-    uint16_t address;
     
     // SJIS to kuten code conversion
     c1 = (code>>8);
@@ -78,6 +159,5 @@ void GT20L16J1Y_FONT::read(unsigned short code) {
     MSB = seq / 94 + 1;
     LSB = seq % 94 + 1;
     
-    address = ((MSB << 8) | LSB);
-    read_kuten(address);
-}
+    return ((MSB << 8) | LSB);
+}
\ No newline at end of file
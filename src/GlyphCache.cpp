@@ -0,0 +1,200 @@
+#include <stddef.h>
+#include <string.h>
+#include "GlyphCache.h"
+#include "KanjiText.h"
+#include "FontSubset.h"
+
+GlyphCache::GlyphCache(GT20L16J1Y_FONT &rom) : _rom(rom)
+{
+    clear();
+    clearCounters();
+}
+
+void GlyphCache::clear()
+{
+    int i;
+
+    for (i = 0; i < GLYPH_CACHE_BUCKETS; i++)
+    {
+        _buckets[i] = -1;
+    }
+    _head = -1;
+    _tail = -1;
+    _used = 0;
+}
+
+void GlyphCache::clearCounters()
+{
+    memset(&counters, 0, sizeof(counters));
+}
+
+int GlyphCache::bucketOf(unsigned short code)
+{
+    return ((code * 0x9E37U) >> 8) & (GLYPH_CACHE_BUCKETS - 1);
+}
+
+void GlyphCache::unlink(int index)
+{
+    Entry &e = _entries[index];
+
+    if (e.prev >= 0)
+        _entries[e.prev].next = e.next;
+    else
+        _head = e.next;
+    if (e.next >= 0)
+        _entries[e.next].prev = e.prev;
+    else
+        _tail = e.prev;
+}
+
+void GlyphCache::pushFront(int index)
+{
+    Entry &e = _entries[index];
+
+    e.prev = -1;
+    e.next = _head;
+    if (_head >= 0)
+        _entries[_head].prev = index;
+    _head = index;
+    if (_tail < 0)
+        _tail = index;
+}
+
+void GlyphCache::unhash(int index)
+{
+    short *link = &_buckets[bucketOf(_entries[index].code)];
+
+    while (*link != index)
+    {
+        link = &_entries[*link].hashNext;
+    }
+    *link = _entries[index].hashNext;
+}
+
+const unsigned char *GlyphCache::sjis(unsigned short code)
+{
+    return kuten(GT20L16J1Y_FONT::sjis_to_kuten(code));
+}
+
+int GlyphCache::find(unsigned short code)
+{
+    int index;
+
+    for (index = _buckets[bucketOf(code)]; index >= 0; index = _entries[index].hashNext)
+    {
+        if (_entries[index].code == code)
+            return index;
+    }
+    return -1;
+}
+
+// Store a glyph read from the ROM (bitmap is modified)
+int GlyphCache::insert(unsigned short code, unsigned char *bitmap, int width)
+{
+    int bucket = bucketOf(code);
+    int index;
+
+    if (_used < GLYPH_CACHE_SIZE)
+    {
+        index = _used++;
+    }
+    else
+    {
+        counters.evictions++;
+        index = _tail;
+        unlink(index);
+        unhash(index);
+    }
+
+    Entry &e = _entries[index];
+    e.code = code;
+    e.width = width;
+    transposeGlyph(bitmap, width, e.cg);
+    e.hashNext = _buckets[bucket];
+    _buckets[bucket] = index;
+    pushFront(index);
+    return index;
+}
+
+const unsigned char *GlyphCache::kuten(unsigned short code, int *width)
+{
+    const unsigned char *glyph;
+    int index;
+
+    glyph = fontSubsetFind(code, width);
+    if (glyph)
+    {
+        counters.flash++;
+        return glyph;
+    }
+
+    index = find(code);
+    if (index >= 0)
+    {
+        counters.hits++;
+        if (index != _head)
+        {
+            unlink(index);
+            pushFront(index);
+        }
+    }
+    else
+    {
+        counters.misses++;
+        index = insert(code, _rom.bitmap, _rom.read_kuten(code));
+    }
+
+    if (width)
+        *width = _entries[index].width;
+    return _entries[index].cg;
+}
+
+void GlyphCache::prefetch(const unsigned short *codes, int count)
+{
+    unsigned short missing[READ_MANY_MAX];
+    unsigned char bitmaps[READ_MANY_MAX * 32];
+    int widths[READ_MANY_MAX];
+    int i, j, n, index, kept;
+
+    // glyphs of this call moved to the front; once they fill the cache the
+    // next insert would evict one of them, so the rest is left to kuten()
+    kept = 0;
+    while (count > 0 && kept < GLYPH_CACHE_SIZE)
+    {
+        n = 0;
+        for (i = 0; i < count && i < READ_MANY_MAX && kept + n < GLYPH_CACHE_SIZE; i++)
+        {
+            if (fontSubsetFind(codes[i], NULL))
+                continue;
+            index = find(codes[i]);
+            if (index >= 0)
+            {
+                // keep it ahead of the glyphs loaded after it
+                if (index != _head)
+                {
+                    unlink(index);
+                    pushFront(index);
+                    kept++;
+                }
+                continue;
+            }
+            for (j = 0; j < n && missing[j] != codes[i]; j++)
+            {
+            }
+            if (j == n)
+                missing[n++] = codes[i];
+        }
+        codes += i;
+        count -= i;
+
+        if (n == 0)
+            continue;
+        _rom.read_many(missing, n, bitmaps, widths);
+        for (i = 0; i < n; i++)
+        {
+            counters.misses++;
+            insert(missing[i], bitmaps + 32 * i, widths[i]);
+        }
+        kept += n;
+    }
+}
@@ -0,0 +1,96 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include "GT20L16J1Y_font.h"
+
+#ifndef GLYPH_CACHE_SIZE
+#define GLYPH_CACHE_SIZE 64 // number of cached glyphs (-D GLYPH_CACHE_SIZE=n to override)
+#endif
+#define GLYPH_CACHE_BUCKETS 128 // hash buckets (power of 2)
+
+/** Hit/miss counters of a GlyphCache */
+struct GlyphCacheCounters {
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long evictions;
+    unsigned long flash; // served from the flash font subset
+};
+
+/** LRU cache of glyphs already converted to the T6963C CGRAM layout
+ *
+ *  Glyphs are keyed by Ku-Ten code and stored in a fixed arena of
+ *  GLYPH_CACHE_SIZE entries (no heap). Lookup goes through a chained hash
+ *  table and eviction through an intrusive LRU list, both O(1). Glyphs in
+ *  the flash font subset are returned from flash and never cached.
+ */
+class GlyphCache {
+  public:
+    /** Create a cache in front of a font ROM
+     *
+     *  @param rom Font ROM glyphs are read from on a miss
+     */
+    GlyphCache(GT20L16J1Y_FONT &rom);
+    virtual ~GlyphCache() {};
+
+    /** Get a glyph from SJIS code
+     *
+     *  @param code Japanese Kanji font code (Shift JIS code)
+     *  @return 32 bytes in CGRAM layout (four 8x8 cells: UL, UR, LL, LR)
+     */
+    const unsigned char *sjis(unsigned short code);
+
+    /** Get a glyph from Ku-Ten code
+     *
+     *  @param code Ku-Ten code ([15:8] Ku, [7:0] Ten; Ku=0 for half-width ASCII)
+     *  @param width Set to the font width (8 or 16) if not NULL
+     *  @return 32 bytes in CGRAM layout (half-width glyphs use UL and LL only)
+     */
+    const unsigned char *kuten(unsigned short code, int *width = 0);
+
+    /** Load the glyphs of a string in one batch
+     *
+     *  Codes that are not cached yet are read with
+     *  GT20L16J1Y_FONT::read_many(), so a row of neighbouring kana costs one
+     *  or two ROM transactions instead of one per glyph. Prefetched glyphs
+     *  count as misses. Cached glyphs of the string are moved to the front,
+     *  and prefetching stops before a glyph of the same call would be
+     *  evicted (strings of more than GLYPH_CACHE_SIZE distinct glyphs).
+     *
+     *  @param codes Kuten codes
+     *  @param count Number of codes
+     */
+    void prefetch(const unsigned short *codes, int count);
+
+    /** Drop every cached glyph (the counters are kept) */
+    void clear();
+
+    void clearCounters();
+
+    GlyphCacheCounters counters;
+
+  private:
+    struct Entry {
+        unsigned short code;
+        unsigned char width;
+        short prev;     // LRU list (towards most recently used)
+        short next;     // LRU list (towards least recently used)
+        short hashNext; // bucket chain
+        unsigned char cg[32];
+    };
+
+    static int bucketOf(unsigned short code);
+    int find(unsigned short code);
+    int insert(unsigned short code, unsigned char *bitmap, int width);
+    void unlink(int index);
+    void pushFront(int index);
+    void unhash(int index);
+
+    GT20L16J1Y_FONT &_rom;
+    Entry _entries[GLYPH_CACHE_SIZE];
+    short _buckets[GLYPH_CACHE_BUCKETS];
+    short _head; // most recently used
+    short _tail; // least recently used
+    int _used;
+};
+
+#endif
@@ -0,0 +1,147 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "KanjiText.h"
+#include "FontSubset.h"
+
+// Transpose one 8x8 cell: out[r] bit (7-c) = in[c] bit r
+//
+// Byte c of the word holds column 7-c, so the three delta swaps of a
+// standard 8x8 bit-matrix transpose (Hacker's Delight 7-3) give the
+// left-to-right CGRAM rows directly.
+static inline void transposeCell(const unsigned char *in, unsigned char *out)
+{
+    uint32_t lo, hi, t;
+
+    lo = in[7] | (in[6] << 8) | (in[5] << 16) | ((uint32_t)in[4] << 24);
+    hi = in[3] | (in[2] << 8) | (in[1] << 16) | ((uint32_t)in[0] << 24);
+
+    // 2x2 blocks
+    t = (lo ^ (lo >> 7)) & 0x00AA00AA;
+    lo = lo ^ t ^ (t << 7);
+    t = (hi ^ (hi >> 7)) & 0x00AA00AA;
+    hi = hi ^ t ^ (t << 7);
+
+    // 4x4 blocks
+    t = (lo ^ (lo >> 14)) & 0x0000CCCC;
+    lo = lo ^ t ^ (t << 14);
+    t = (hi ^ (hi >> 14)) & 0x0000CCCC;
+    hi = hi ^ t ^ (t << 14);
+
+    // 8x8: swap the upper-right and lower-left nibbles between the halves
+    t = ((lo >> 4) ^ hi) & 0x0F0F0F0F;
+    hi = hi ^ t;
+    lo = lo ^ (t << 4);
+
+    out[0] = lo;
+    out[1] = lo >> 8;
+    out[2] = lo >> 16;
+    out[3] = lo >> 24;
+    out[4] = hi;
+    out[5] = hi >> 8;
+    out[6] = hi >> 16;
+    out[7] = hi >> 24;
+}
+
+void transposeCg(const unsigned char *bitmap, unsigned char *cgData)
+{
+    transposeCell(bitmap, cgData);
+    transposeCell(bitmap + 8, cgData + 8);
+    transposeCell(bitmap + 16, cgData + 16);
+    transposeCell(bitmap + 24, cgData + 24);
+}
+
+void transposeGlyph(unsigned char *bitmap, int width, unsigned char *cgData)
+{
+    if (width == 8)
+    {
+        // 8x16: upper half to UL, lower half to LL
+        memcpy(bitmap + 16, bitmap + 8, 8);
+        memset(bitmap + 8, 0, 8);
+        memset(bitmap + 24, 0, 8);
+    }
+    transposeCg(bitmap, cgData);
+}
+
+void read2BytesCg(GT20L16J1Y_FONT &rom, unsigned char *cgData, unsigned short code)
+{
+    // printf("! read2BytesData\n");
+    rom.read(code);
+    transposeCg(rom.bitmap, cgData);
+}
+
+// Start fetching the glyph of the SJIS pair at str; returns the flash copy
+// instead if the glyph is in the font subset
+static const unsigned char *startGlyph(GT20L16J1Y_FONT &rom, const char *str, unsigned char *slot)
+{
+    union convUShortByte conv;
+    const unsigned char *glyph;
+    unsigned short code;
+
+    conv.ucData[1] = str[0];
+    conv.ucData[0] = str[1];
+    code = GT20L16J1Y_FONT::sjis_to_kuten(conv.usData);
+    glyph = fontSubsetFind(code, NULL);
+    if (glyph == NULL)
+        rom.read_kuten_async(code, slot);
+    return glyph;
+}
+
+// Glyph i+1 is fetched from the ROM (DMA) while glyph i is transposed and
+// auto-written, using two bitmap slots in turn
+void writeKanjiStr(T6963C &lcd, GT20L16J1Y_FONT &rom, char *str)
+{
+    unsigned int i, length;
+    unsigned char slot[2][32];
+    unsigned char cgData[32];
+    const unsigned char *glyph[2];
+    int n;
+    // char buf[256];
+    // utf8tosjis(str,strlen(str),buf,sizeof(buf));
+
+    length = strlen(str);
+    if (length == 0)
+        return;
+
+    glyph[0] = startGlyph(rom, str, slot[0]);
+    for (i = 0, n = 0; i < length; i += 2, n ^= 1)
+    {
+        rom.wait();
+        if (i + 2 < length)
+            glyph[n ^ 1] = startGlyph(rom, str + i + 2, slot[n ^ 1]);
+        if (glyph[n] == NULL)
+        {
+            transposeCg(slot[n], cgData);
+            glyph[n] = cgData;
+        }
+        lcd.autoDataWrite(glyph[n], 32);
+    }
+}
+
+void writeKanjiStr(T6963C &lcd, GlyphCache &cache, char *str)
+{
+    unsigned int i, n;
+    union convUShortByte conv;
+    unsigned short codes[READ_MANY_MAX];
+
+    // Fetch the missing glyphs of the whole string in address-sorted bursts
+    for (i = 0, n = 0; i < strlen(str); i += 2)
+    {
+        conv.ucData[1] = str[i];
+        conv.ucData[0] = str[i + 1];
+        codes[n++] = GT20L16J1Y_FONT::sjis_to_kuten(conv.usData);
+        if (n == READ_MANY_MAX)
+        {
+            cache.prefetch(codes, n);
+            n = 0;
+        }
+    }
+    cache.prefetch(codes, n);
+
+    for (i = 0; i < strlen(str); i += 2)
+    {
+        conv.ucData[1] = str[i];
+        conv.ucData[0] = str[i + 1];
+        lcd.autoDataWrite(cache.sjis(conv.usData), 32);
+    }
+}
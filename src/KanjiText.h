@@ -0,0 +1,51 @@
+#ifndef KANJI_TEXT_H
+#define KANJI_TEXT_H
+
+#include "T6963C.h"
+#include "GT20L16J1Y_font.h"
+#include "GlyphCache.h"
+
+/** Convert a 16x16 glyph from the font ROM layout to the T6963C CGRAM layout
+ *
+ *  @param bitmap 32 bytes as read by GT20L16J1Y_FONT (column bytes)
+ *  @param cgData 32 bytes destination (four 8x8 cells: UL, UR, LL, LR)
+ */
+void transposeCg(const unsigned char *bitmap, unsigned char *cgData);
+
+/** Convert an 8x16 or 16x16 glyph from the font ROM layout to the CGRAM layout
+ *
+ *  Half-width glyphs end up in UL (upper half) and LL (lower half).
+ *
+ *  @param bitmap Glyph as read by GT20L16J1Y_FONT (modified for width 8)
+ *  @param width Font width (8 or 16)
+ *  @param cgData 32 bytes destination (four 8x8 cells: UL, UR, LL, LR)
+ */
+void transposeGlyph(unsigned char *bitmap, int width, unsigned char *cgData);
+
+/** Read a 16x16 glyph and convert it to the T6963C CGRAM layout
+ *
+ *  @param rom Font ROM to read from
+ *  @param cgData 32 bytes destination (four 8x8 cells: UL, UR, LL, LR)
+ *  @param code Japanese Kanji font code (Shift JIS code)
+ */
+void read2BytesCg(GT20L16J1Y_FONT &rom, unsigned char *cgData, unsigned short code);
+
+/** Auto-write the glyphs of a Shift JIS string at the current address pointer
+ *
+ *  The ROM read of the next glyph overlaps the LCD write of the current one.
+ *
+ *  @param lcd Display to write to
+ *  @param rom Font ROM to read from
+ *  @param str Shift JIS string (2 bytes per character)
+ */
+void writeKanjiStr(T6963C &lcd, GT20L16J1Y_FONT &rom, char *str);
+
+/** Auto-write the glyphs of a Shift JIS string through a glyph cache
+ *
+ *  @param lcd Display to write to
+ *  @param cache Glyph cache to take the glyphs from
+ *  @param str Shift JIS string (2 bytes per character)
+ */
+void writeKanjiStr(T6963C &lcd, GlyphCache &cache, char *str);
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef KEY_MATRIX_PORT_H
+#define KEY_MATRIX_PORT_H
+
+#include <stdint.h>
+
+/** Column-driven key matrix and a microsecond time base
+ *
+ *  The scanner selects one column, waits one scan period for the lines to
+ *  settle and then reads the rows, so a port never has to delay.
+ */
+class KeyMatrixPort {
+  public:
+    virtual ~KeyMatrixPort() {};
+
+    /** Make one column active and all others inactive
+     *
+     *  @param column Column number (0 to KEYPAD_COLS-1)
+     */
+    virtual void selectColumn(int column) = 0;
+
+    /** Rows of the selected column, bit n set = key on row n pressed */
+    virtual unsigned char readRows() = 0;
+
+    /** Free-running microsecond counter (wraps at 2^32) */
+    virtual uint32_t nowUs() = 0;
+};
+
+#endif
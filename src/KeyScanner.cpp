@@ -0,0 +1,102 @@
+#include <string.h>
+#include "KeyScanner.h"
+
+KeyScanner::KeyScanner(KeyMatrixPort &port) : _port(port)
+{
+    _column = 0;
+    _stable = 0;
+    memset(_count, 0, sizeof(_count));
+    memset(_edgeUs, 0, sizeof(_edgeUs));
+    memset(_repeatUs, 0, sizeof(_repeatUs));
+    clearCounters();
+    _port.selectColumn(_column);
+}
+
+void KeyScanner::clearCounters()
+{
+    memset(&counters, 0, sizeof(counters));
+}
+
+void KeyScanner::scan()
+{
+    uint32_t now = _port.nowUs();
+    unsigned char rows = _port.readRows();
+    bool raw, stable;
+    int row, key;
+
+    counters.scans++;
+    for (row = 0; row < KEYPAD_ROWS; row++)
+    {
+        key = row * KEYPAD_COLS + _column;
+        raw = (rows >> row) & 1;
+        stable = (_stable >> key) & 1;
+
+        if (raw == stable)
+        {
+            if (_count[key] != 0)
+            {
+                counters.bounces++;
+                _count[key] = 0;
+            }
+            if (stable && (int32_t)(now - _repeatUs[key]) >= 0)
+            {
+                post(key, KEY_REPEAT, _repeatUs[key], now);
+                _repeatUs[key] += KEYPAD_REPEAT_US;
+            }
+            continue;
+        }
+
+        if (_count[key]++ == 0)
+            _edgeUs[key] = now;
+        if (_count[key] < KEYPAD_DEBOUNCE)
+            continue;
+
+        _count[key] = 0;
+        _stable ^= 1u << key;
+        if (raw)
+            _repeatUs[key] = now + KEYPAD_REPEAT_DELAY_US;
+        post(key, raw ? KEY_PRESS : KEY_RELEASE, _edgeUs[key], now);
+    }
+
+    // the next column settles until the next call
+    _column = (_column + 1) % KEYPAD_COLS;
+    _port.selectColumn(_column);
+}
+
+void KeyScanner::post(int key, KeyEventType type, uint32_t edgeUs, uint32_t now)
+{
+    KeyEvent event;
+
+    event.key = key;
+    event.type = type;
+    event.edgeUs = edgeUs;
+    event.postUs = now;
+    if (!_events.put(event))
+    {
+        counters.missed++;
+        return;
+    }
+    counters.events++;
+    if (now - edgeUs > counters.maxDebounceUs)
+        counters.maxDebounceUs = now - edgeUs;
+}
+
+bool KeyScanner::poll(KeyEvent &event)
+{
+    uint32_t latency;
+
+    if (!_events.get(event))
+        return false;
+
+    latency = _port.nowUs() - event.edgeUs;
+    counters.polled++;
+    counters.latencyUs += latency;
+    if (latency > counters.maxLatencyUs)
+        counters.maxLatencyUs = latency;
+    return true;
+}
+
+bool KeyScanner::pressed(int key)
+{
+    return (_stable >> key) & 1;
+}
@@ -0,0 +1,102 @@
+#ifndef KEY_SCANNER_H
+#define KEY_SCANNER_H
+
+#include <stdint.h>
+#include "KeyMatrixPort.h"
+#include "EventRing.h"
+
+#define KEYPAD_ROWS 7
+#define KEYPAD_COLS 4
+#define KEYPAD_KEYS (KEYPAD_ROWS * KEYPAD_COLS)
+
+#ifndef KEYPAD_SCAN_US
+#define KEYPAD_SCAN_US 1000 // scan() period; one column per call
+#endif
+#ifndef KEYPAD_DEBOUNCE
+#define KEYPAD_DEBOUNCE 3 // consecutive samples a change must last
+#endif
+#ifndef KEYPAD_REPEAT_DELAY_US
+#define KEYPAD_REPEAT_DELAY_US 500000 // press -> first repeat
+#endif
+#ifndef KEYPAD_REPEAT_US
+#define KEYPAD_REPEAT_US 100000 // repeat interval while held
+#endif
+#define KEYPAD_QUEUE 16 // queued events (power of 2)
+
+enum KeyEventType {
+    KEY_PRESS,
+    KEY_RELEASE,
+    KEY_REPEAT,
+};
+
+/** One debounced key change */
+struct KeyEvent {
+    unsigned char key;  // row * KEYPAD_COLS + column
+    unsigned char type; // KeyEventType
+    uint32_t edgeUs;    // first sample that saw the change (repeat: when due)
+    uint32_t postUs;    // when the event was queued
+};
+
+/** Counters of a KeyScanner
+ *
+ *  scans to maxDebounceUs are written by scan(), the rest by poll().
+ */
+struct KeyScanCounters {
+    unsigned long scans;         // scan() calls
+    unsigned long events;        // events queued
+    unsigned long missed;        // events dropped, queue full
+    unsigned long bounces;       // changes that did not last KEYPAD_DEBOUNCE samples
+    uint32_t maxDebounceUs;      // edge -> queued
+    unsigned long polled;        // events taken by poll()
+    uint32_t maxLatencyUs;       // edge -> taken by poll()
+    unsigned long long latencyUs; // sum over polled events
+};
+
+/** Keypad matrix scanner with debouncing and an event queue
+ *
+ *  scan() is meant to run from a timer interrupt every KEYPAD_SCAN_US, so
+ *  key timing does not depend on what the main loop is doing (e.g. a long
+ *  memoryClear()). Each call samples one column; a key changes state after
+ *  KEYPAD_DEBOUNCE matching samples and the change is queued as a KeyEvent.
+ *  Held keys repeat. The main loop drains the queue with poll(); the queue
+ *  is lock-free, so neither side masks interrupts.
+ */
+class KeyScanner {
+  public:
+    /** Create a scanner and select the first column
+     *
+     *  @param port Key matrix the scanner reads
+     */
+    KeyScanner(KeyMatrixPort &port);
+    virtual ~KeyScanner() {};
+
+    /** Sample one column and select the next (timer ISR) */
+    void scan();
+
+    /** Take the next event (main loop)
+     *
+     *  @param event Receives the event
+     *  @return false if no event is queued
+     */
+    bool poll(KeyEvent &event);
+
+    /** true while a key is pressed (debounced) */
+    bool pressed(int key);
+
+    void clearCounters();
+
+    KeyScanCounters counters;
+
+  private:
+    void post(int key, KeyEventType type, uint32_t edgeUs, uint32_t now);
+
+    KeyMatrixPort &_port;
+    int _column;
+    volatile uint32_t _stable;           // debounced state, bit per key
+    unsigned char _count[KEYPAD_KEYS];   // samples disagreeing with _stable
+    uint32_t _edgeUs[KEYPAD_KEYS];       // first disagreeing sample
+    uint32_t _repeatUs[KEYPAD_KEYS];     // next repeat of a held key
+    EventRing<KeyEvent, KEYPAD_QUEUE> _events;
+};
+
+#endif
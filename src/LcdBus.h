@@ -0,0 +1,82 @@
+#ifndef LCD_BUS_H
+#define LCD_BUS_H
+
+/** Transaction counters of a T6963C bus */
+struct LcdBusCounters {
+    unsigned long statusReads;   // C/D=1, RD strobes
+    unsigned long commandWrites; // C/D=1, WR strobes
+    unsigned long dataWrites;    // C/D=0, WR strobes
+    unsigned long dataReads;     // C/D=0, RD strobes
+};
+
+/** 8-bit parallel bus of a T6963C controller
+ *
+ *  The driver only talks to the controller through the four bus cycles
+ *  and the delay below, so the same driver runs on the mbed pins or on the host simulator.
+ *  Every cycle is counted in counters.
+ */
+class LcdBus {
+  public:
+    LcdBus() { clearCounters(); };
+    virtual ~LcdBus() {};
+
+    /** Pulse ~RESET and leave the bus in the idle (output) state */
+    virtual void reset() = 0;
+
+    /** Read the status byte (union statusCode) */
+    unsigned char readStatus()
+    {
+        counters.statusReads++;
+        return doReadStatus();
+    }
+
+    /** Write a command byte */
+    void writeCommand(unsigned char command)
+    {
+        counters.commandWrites++;
+        doWriteCommand(command);
+    }
+
+    /** Write a data byte */
+    void writeData(unsigned char data)
+    {
+        counters.dataWrites++;
+        doWriteData(data);
+    }
+
+    /** Read a data byte */
+    unsigned char readData()
+    {
+        counters.dataReads++;
+        return doReadData();
+    }
+
+    /** Busy wait between bus cycles
+     *
+     *  @param ns Minimum time in ns
+     */
+    void delay(unsigned int ns)
+    {
+        if (ns != 0)
+            doDelay(ns);
+    }
+
+    void clearCounters()
+    {
+        counters.statusReads = 0;
+        counters.commandWrites = 0;
+        counters.dataWrites = 0;
+        counters.dataReads = 0;
+    }
+
+    LcdBusCounters counters;
+
+  protected:
+    virtual unsigned char doReadStatus() = 0;
+    virtual void doWriteCommand(unsigned char command) = 0;
+    virtual void doWriteData(unsigned char data) = 0;
+    virtual unsigned char doReadData() = 0;
+    virtual void doDelay(unsigned int ns) = 0;
+};
+
+#endif
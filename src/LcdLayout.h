@@ -0,0 +1,41 @@
+#ifndef LCD_LAYOUT_H
+#define LCD_LAYOUT_H
+
+#define DISPLAY_WIDTH 30  // ディスプレイ桁数(8*nドット)
+#define DISPLAY_HEIGHT 16 // ディスプレイ行数(8*n ドット)
+
+// Double buffering: two graphics pages after the text area, then a second
+// text page. DoubleBuffer flips DISP_GRPH_HOME_ADDR / DISP_TEXT_HOME_ADDR.
+#define TEXT_PAGE_SIZE (DISPLAY_WIDTH * DISPLAY_HEIGHT)     // one screen of text codes
+#define GRPH_PAGE_SIZE (DISPLAY_WIDTH * DISPLAY_HEIGHT * 8) // one screen of pixels
+#define VRAM_PAGES 2
+#define VRAM_GRPH_PAGE(n) (VRAM_GRPH_ADDR + (n) * GRPH_PAGE_SIZE)
+#define VRAM_TEXT_PAGE(n) ((n) == 0 ? VRAM_TEXT_ADDR : VRAM_GRPH_PAGE(VRAM_PAGES))
+
+// TextConsole: a ring of CONSOLE_RING_ROWS text rows plus DISPLAY_HEIGHT-1
+// mirrored rows after VRAM_END, so any DISPLAY_HEIGHT rows starting inside
+// the ring are contiguous; the graphics ring shadows it row for row. The
+// ring has one row more than the window, so the next line is cleared while
+// it is off screen.
+#define CONSOLE_RING_ROWS (DISPLAY_HEIGHT + 1)
+#define CONSOLE_ROWS (CONSOLE_RING_ROWS + DISPLAY_HEIGHT - 1)
+#define VRAM_CONSOLE_TEXT_ADDR VRAM_END
+#define VRAM_CONSOLE_GRPH_ADDR (VRAM_CONSOLE_TEXT_ADDR + CONSOLE_ROWS * DISPLAY_WIDTH)
+#define VRAM_CONSOLE_END (VRAM_CONSOLE_GRPH_ADDR + CONSOLE_ROWS * DISPLAY_WIDTH * 8)
+
+#define VRAM_START 0x0000                                                        // VRAM開始アドレス
+#define VRAM_TEXT_ADDR VRAM_START                                                // テキスト開始アドレス
+#define VRAM_GRPH_ADDR (VRAM_TEXT_ADDR + (DISPLAY_WIDTH * DISPLAY_HEIGHT))       // グラフィック開始アドレス
+#define VRAM_END (VRAM_TEXT_PAGE(1) + TEXT_PAGE_SIZE)                            // VRAM終了アドレス
+#define CGRAM_START ((VRAM_CONSOLE_END & 0xF800) + 0x1800)                       // CGRAM開始アドレス
+#define CGRAM_STORE_OFFSET 0x400                                                 // 文字コード0x80以降に置くためのオフセット
+#define CGRAM_COUNT 0x800                                                        // CGRAMに登録する文字数
+#define CGRAM_END (CGRAM_START + CGRAM_STORE_OFFSET + (8 * CGRAM_COUNT))         // CGRAM終了アドレス
+
+#define VRAM_MAP_SIZE 0x10000 // T6963C address space
+
+static_assert(VRAM_CONSOLE_END <= CGRAM_START, "display pages or console ring overlap CGRAM");
+static_assert((CGRAM_START & 0x7FF) == 0, "CGRAM must start on a 2KB boundary (REG_OFFSET)");
+static_assert(CGRAM_END <= VRAM_MAP_SIZE, "CGRAM does not fit in the 64KB VRAM map");
+
+#endif
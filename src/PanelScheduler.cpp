@@ -0,0 +1,209 @@
+#include <string.h>
+#include "PanelScheduler.h"
+
+PanelScheduler::PanelScheduler()
+{
+    _count = 0;
+    clearCounters();
+}
+
+int PanelScheduler::add(T6963C &lcd, LcdBus &bus)
+{
+    if (_count == PANEL_MAX)
+        return -1;
+
+    Panel &panel = _panels[_count];
+    panel.lcd = &lcd;
+    panel.bus = &bus;
+    panel.head = 0;
+    panel.count = 0;
+    panel.phase = 0;
+    return _count++;
+}
+
+void PanelScheduler::setAddress(int panel, int addr)
+{
+    setRegister(panel, REG_ADDR, addr);
+}
+
+void PanelScheduler::write(int panel, const unsigned char *data, int length)
+{
+    PanelOp op;
+
+    memset(&op, 0, sizeof(op));
+    op.op = OP_WRITE;
+    op.length = length;
+    op.data = data;
+    queue(panel, op);
+}
+
+void PanelScheduler::write(int panel, int addr, const unsigned char *data, int length)
+{
+    setAddress(panel, addr);
+    write(panel, data, length);
+}
+
+void PanelScheduler::fill(int panel, int addr, unsigned char value, int length)
+{
+    PanelOp op;
+
+    memset(&op, 0, sizeof(op));
+    op.op = OP_FILL;
+    op.fill = value;
+    op.value = addr;
+    op.length = length;
+    queue(panel, op);
+}
+
+void PanelScheduler::setRegister(int panel, unsigned char command, unsigned short value)
+{
+    PanelOp op;
+
+    memset(&op, 0, sizeof(op));
+    op.op = OP_REGISTER;
+    op.command = command;
+    op.value = value;
+    queue(panel, op);
+}
+
+void PanelScheduler::command(int panel, unsigned char command)
+{
+    PanelOp op;
+
+    memset(&op, 0, sizeof(op));
+    op.op = OP_COMMAND;
+    op.command = command;
+    queue(panel, op);
+}
+
+int PanelScheduler::pending(int panel)
+{
+    return _panels[panel].count;
+}
+
+void PanelScheduler::queue(int panel, const PanelOp &op)
+{
+    int i;
+
+    if (panel == PANEL_ALL)
+    {
+        for (i = 0; i < _count; i++)
+        {
+            queue(i, op);
+        }
+        return;
+    }
+
+    Panel &p = _panels[panel];
+    if (p.count == PANEL_QUEUE)
+        run();
+    p.queue[(p.head + p.count) % PANEL_QUEUE] = op;
+    p.count++;
+}
+
+void PanelScheduler::run()
+{
+    int i, active;
+
+    counters.runs++;
+    for (i = 0; i < _count; i++)
+    {
+        if (_panels[i].count != 0)
+            _panels[i].lcd->flush();
+    }
+
+    // one bus cycle per panel and turn; a busy panel passes its turn
+    do
+    {
+        active = 0;
+        for (i = 0; i < _count; i++)
+        {
+            if (_panels[i].count == 0)
+                continue;
+            active++;
+            step(_panels[i]);
+        }
+    } while (active != 0);
+
+    for (i = 0; i < _count; i++)
+    {
+        _panels[i].lcd->invalidate();
+    }
+}
+
+// Next bus cycle of the panel's current operation if the panel is ready
+bool PanelScheduler::step(Panel &panel)
+{
+    const PanelOp &op = panel.queue[panel.head];
+    union statusCode stcd;
+    int phase = panel.phase, last;
+    bool isCommand, autoMode = false;
+    unsigned char value;
+
+    // OP_FILL: REG_ADDR first, then the burst
+    if (op.op == OP_FILL && phase < 3)
+    {
+        isCommand = phase == 2;
+        value = phase == 0 ? op.value & 0xFF : phase == 1 ? op.value >> 8 : REG_ADDR;
+        last = -1;
+    }
+    else if (op.op == OP_REGISTER)
+    {
+        isCommand = phase == 2;
+        value = phase == 0 ? op.value & 0xFF : phase == 1 ? op.value >> 8 : op.command;
+        last = 2;
+    }
+    else if (op.op == OP_COMMAND)
+    {
+        isCommand = true;
+        value = op.command;
+        last = 0;
+    }
+    else
+    {
+        // AUTO_WRITE, length bytes, AUTO_RESET
+        if (op.op == OP_FILL)
+            phase -= 3;
+        last = op.length + 1;
+        isCommand = phase == 0 || phase == last;
+        autoMode = phase != 0;
+        if (phase == 0 || phase == last)
+            value = phase == 0 ? AUTO_WRITE : AUTO_RESET;
+        else
+            value = op.data != NULL ? op.data[phase - 1] : op.fill;
+    }
+
+    stcd.usData = panel.bus->readStatus();
+    counters.polls++;
+    if (stcd.tBit.comEn == 0 || (autoMode ? stcd.tBit.aWR : stcd.tBit.rwEn) == 0)
+    {
+        counters.busy++;
+        return false;
+    }
+
+    if (isCommand)
+        panel.bus->writeCommand(value);
+    else
+        panel.bus->writeData(value);
+    counters.cycles++;
+
+    if (phase == last)
+    {
+        panel.head = (panel.head + 1) % PANEL_QUEUE;
+        panel.count--;
+        panel.phase = 0;
+    }
+    else
+    {
+        panel.phase++;
+    }
+    return true;
+}
+
+void PanelScheduler::clearCounters()
+{
+    counters.cycles = 0;
+    counters.polls = 0;
+    counters.busy = 0;
+    counters.runs = 0;
+}
@@ -0,0 +1,111 @@
+#ifndef PANEL_SCHEDULER_H
+#define PANEL_SCHEDULER_H
+
+#include "T6963C.h"
+
+#ifndef PANEL_MAX
+#define PANEL_MAX 2 // panels on the shared bus
+#endif
+#ifndef PANEL_QUEUE
+#define PANEL_QUEUE 32 // queued operations per panel
+#endif
+
+#define PANEL_ALL -1 // panel index: mirror to every panel
+
+/** Bus cycles of a PanelScheduler */
+struct PanelSchedulerCounters {
+    unsigned long cycles; // command and data writes
+    unsigned long polls;  // status reads
+    unsigned long busy;   // status reads that found the panel busy
+    unsigned long runs;   // run() calls, including the ones of a full queue
+};
+
+/** One queued panel operation */
+struct PanelOp {
+    unsigned char op;          // PanelScheduler::Op
+    unsigned char command;     // T6963C command byte (OP_REGISTER, OP_COMMAND)
+    unsigned char fill;        // fill value (OP_FILL)
+    unsigned short value;      // register value or fill address
+    unsigned short length;     // bytes (OP_WRITE, OP_FILL)
+    const unsigned char *data; // caller's bytes (OP_WRITE)
+};
+
+/** Interleaves the bus cycles of T6963C panels sharing one data bus
+ *
+ *  Each panel is a T6963C on its own LcdBus; the buses share D0-D7, ~WR,
+ *  ~RD and C/D and differ in ~CE. Operations are queued per panel (or to
+ *  PANEL_ALL for mirrored updates) and run() issues them one bus cycle at
+ *  a time: a panel whose status reads busy is skipped and the next one
+ *  gets the bus, so the busy time of one controller is spent writing to
+ *  the others.
+ *
+ *  The data of write() is not copied and must stay valid until run()
+ *  returns. run() closes the panels' open bursts first and invalidates
+ *  their state caches afterwards.
+ */
+class PanelScheduler {
+  public:
+    enum Op {
+        OP_REGISTER, // two byte register
+        OP_COMMAND,  // command without data
+        OP_WRITE,    // AUTO_WRITE burst at the address pointer
+        OP_FILL,     // REG_ADDR + AUTO_WRITE burst of one value
+    };
+
+    PanelScheduler();
+    virtual ~PanelScheduler() {};
+
+    /** Add a panel
+     *
+     *  @param lcd Driver of the panel, used outside run()
+     *  @param bus Bus of the panel (its ~CE)
+     *  @return Panel index, -1 if PANEL_MAX panels are added
+     */
+    int add(T6963C &lcd, LcdBus &bus);
+
+    /** Set the address pointer */
+    void setAddress(int panel, int addr);
+
+    /** Write bytes at the address pointer (auto increment) */
+    void write(int panel, const unsigned char *data, int length);
+
+    /** Write bytes at a VRAM address */
+    void write(int panel, int addr, const unsigned char *data, int length);
+
+    /** Fill [addr, addr + length) with a value */
+    void fill(int panel, int addr, unsigned char value, int length);
+
+    /** Set a two byte register, low byte first on the bus */
+    void setRegister(int panel, unsigned char command, unsigned short value);
+
+    /** Send a command without data */
+    void command(int panel, unsigned char command);
+
+    /** Run everything queued, interleaving the panels */
+    void run();
+
+    /** Queued operations of a panel */
+    int pending(int panel);
+
+    void clearCounters();
+
+    PanelSchedulerCounters counters;
+
+  private:
+    struct Panel {
+        T6963C *lcd;
+        LcdBus *bus;
+        PanelOp queue[PANEL_QUEUE];
+        int head;
+        int count;
+        int phase; // bus cycle within queue[head]
+    };
+
+    void queue(int panel, const PanelOp &op);
+    bool step(Panel &panel);
+
+    Panel _panels[PANEL_MAX];
+    int _count;
+};
+
+#endif
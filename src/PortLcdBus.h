@@ -0,0 +1,231 @@
+#ifndef PORT_LCD_BUS_H
+#define PORT_LCD_BUS_H
+
+#include <stdint.h>
+#include "LcdBus.h"
+
+// GPIO ports searched for bus pins (A-H)
+#ifndef LCD_GPIO_PORTS
+#define LCD_GPIO_PORTS 8
+#endif
+
+// ~WR/~RD strobe width in ns (data setup and read access time)
+#ifndef LCD_PORT_STROBE_NS
+#define LCD_PORT_STROBE_NS 150
+#endif
+
+/** Pin number in the STM32 PinName encoding: port (0=A) << 4 | pin */
+#define GPIO_PIN(port, pin) (((port) << 4) | (pin))
+
+/** Register level layout of a bus pin assignment
+ *
+ *  Pins is a struct of static const int DB0-DB7, WR, RD, CE, CD and RST in
+ *  the GPIO_PIN() encoding. Everything is evaluated at compile time, so a
+ *  bus on one port with DB0-DB7 on consecutive pins writes its data with a
+ *  single shifted BSRR value and reads it with a single shift of IDR.
+ */
+template <class Pins> struct PortBusMap {
+    static constexpr int port(int pin) { return pin >> 4; }
+    static constexpr uint32_t bit(int pin) { return 1u << (pin & 15); }
+
+    static constexpr int data(int n)
+    {
+        return n == 0 ? Pins::DB0 : n == 1 ? Pins::DB1 : n == 2 ? Pins::DB2 : n == 3 ? Pins::DB3 :
+               n == 4 ? Pins::DB4 : n == 5 ? Pins::DB5 : n == 6 ? Pins::DB6 : Pins::DB7;
+    }
+
+    /** BSRR bits driving pin to level, 0 if the pin is not on port p */
+    static constexpr uint32_t drive(int p, int pin, bool level)
+    {
+        return port(pin) != p ? 0 : level ? bit(pin) : bit(pin) << 16;
+    }
+
+    /** Data pins on port p */
+    static constexpr uint32_t dataMask(int p, int n = 0)
+    {
+        return n == 8 ? 0 : (port(data(n)) == p ? bit(data(n)) : 0) | dataMask(p, n + 1);
+    }
+
+    /** MODER fields of the data pins on port p */
+    static constexpr uint32_t moderMask(int p, int n = 0)
+    {
+        return n == 8 ? 0 : (port(data(n)) == p ? 3u << 2 * (data(n) & 15) : 0) | moderMask(p, n + 1);
+    }
+
+    /** Control pins (WR, RD, CE, CD) on port p */
+    static constexpr uint32_t controlMask(int p)
+    {
+        return drive(p, Pins::WR, true) | drive(p, Pins::RD, true) | drive(p, Pins::CE, true) | drive(p, Pins::CD, true);
+    }
+
+    /** DB0-DB7 are consecutive pins of one port */
+    static constexpr bool consecutive(int n = 1)
+    {
+        return n == 8 || (data(n) == Pins::DB0 + n && (Pins::DB0 & 15) + n < 16 && consecutive(n + 1));
+    }
+
+    /** BSRR value putting value on the data pins of port p */
+    static uint32_t scatter(int p, unsigned char value)
+    {
+        if (consecutive())
+            return (uint32_t)value << (Pins::DB0 & 15) | (uint32_t)(unsigned char)~value << ((Pins::DB0 & 15) + 16);
+        return drive(p, Pins::DB0, value & 0x01) | drive(p, Pins::DB1, value & 0x02) |
+               drive(p, Pins::DB2, value & 0x04) | drive(p, Pins::DB3, value & 0x08) |
+               drive(p, Pins::DB4, value & 0x10) | drive(p, Pins::DB5, value & 0x20) |
+               drive(p, Pins::DB6, value & 0x40) | drive(p, Pins::DB7, value & 0x80);
+    }
+
+    /** Data bits of port p in an IDR value */
+    static unsigned char gather(int p, uint32_t idr)
+    {
+        if (consecutive())
+            return (unsigned char)(idr >> (Pins::DB0 & 15));
+        return sample(p, Pins::DB0, idr, 0x01) | sample(p, Pins::DB1, idr, 0x02) |
+               sample(p, Pins::DB2, idr, 0x04) | sample(p, Pins::DB3, idr, 0x08) |
+               sample(p, Pins::DB4, idr, 0x10) | sample(p, Pins::DB5, idr, 0x20) |
+               sample(p, Pins::DB6, idr, 0x40) | sample(p, Pins::DB7, idr, 0x80);
+    }
+
+    static constexpr unsigned char sample(int p, int pin, uint32_t idr, unsigned char value)
+    {
+        return port(pin) == p && (idr & bit(pin)) ? value : 0;
+    }
+};
+
+/** Register accesses of one bus phase, unrolled over the GPIO ports
+ *
+ *  Ports without bus pins compile to nothing.
+ */
+template <class Gpio, class Pins, int P> struct PortBusOps {
+    typedef PortBusMap<Pins> Map;
+    typedef PortBusOps<Gpio, Pins, P + 1> Next;
+
+    static void write(unsigned char value)
+    {
+        constexpr uint32_t mask = Map::dataMask(P);
+        if (mask != 0)
+            Gpio::bsrr(P, Map::scatter(P, value));
+        Next::write(value);
+    }
+
+    static unsigned char read()
+    {
+        constexpr uint32_t mask = Map::dataMask(P);
+        return (mask != 0 ? Map::gather(P, Gpio::idr(P)) : 0) | Next::read();
+    }
+
+    static void direction(bool output)
+    {
+        constexpr uint32_t mask = Map::moderMask(P);
+        if (mask != 0)
+            Gpio::moder(P, mask, output ? mask & 0x55555555u : 0);
+        Next::direction(output);
+    }
+
+    static void control(bool cd, bool ce, bool rd, bool wr)
+    {
+        constexpr uint32_t mask = Map::controlMask(P);
+        if (mask != 0)
+            Gpio::bsrr(P, Map::drive(P, Pins::CD, cd) | Map::drive(P, Pins::CE, ce) |
+                              Map::drive(P, Pins::RD, rd) | Map::drive(P, Pins::WR, wr));
+        Next::control(cd, ce, rd, wr);
+    }
+};
+
+template <class Gpio, class Pins> struct PortBusOps<Gpio, Pins, LCD_GPIO_PORTS> {
+    static void write(unsigned char) {}
+    static unsigned char read() { return 0; }
+    static void direction(bool) {}
+    static void control(bool, bool, bool, bool) {}
+};
+
+/** T6963C bus driven through the GPIO registers
+ *
+ *  The pin assignment is the compile-time parameter Pins (see PortBusMap).
+ *  Each bus phase is one masked register access per port that carries
+ *  bus pins: BSRR for the data and strobes, MODER for the data direction.
+ *  Gpio provides the register access:
+ *
+ *      static void output(int pin);  // configure a push-pull output
+ *      static void bsrr(int port, uint32_t value);
+ *      static void moder(int port, uint32_t mask, uint32_t value);
+ *      static uint32_t idr(int port);
+ *      static void wait(unsigned int ns);
+ *      static void sleep(int ms);
+ *
+ *  Stm32Gpio (mbed) uses the real registers, FakeGpio (host) a register
+ *  file decoded into simulator bus cycles.
+ */
+template <class Gpio, class Pins> class PortLcdBus : public LcdBus {
+  public:
+    PortLcdBus()
+    {
+        int n;
+
+        for (n = 0; n < 8; n++)
+        {
+            Gpio::output(Map::data(n));
+        }
+        Gpio::output(Pins::WR);
+        Gpio::output(Pins::RD);
+        Gpio::output(Pins::CE);
+        Gpio::output(Pins::CD);
+        Gpio::output(Pins::RST);
+        // deselected: panels sharing the data bus have their own ~CE
+        Ops::control(false, true, true, true);
+    }
+    virtual ~PortLcdBus() {};
+
+    virtual void reset()
+    {
+        pin(Pins::RST, false);
+
+        Ops::direction(true);
+        Ops::control(false, true, true, true);
+        Ops::write(0);
+
+        Gpio::sleep(5);
+        pin(Pins::RST, true);
+        Gpio::sleep(5);
+    }
+
+  protected:
+    virtual unsigned char doReadStatus() { return read(true); }
+    virtual void doWriteCommand(unsigned char command) { write(true, command); }
+    virtual void doWriteData(unsigned char data) { write(false, data); }
+    virtual unsigned char doReadData() { return read(false); }
+    virtual void doDelay(unsigned int ns) { Gpio::wait(ns); }
+
+  private:
+    typedef PortBusMap<Pins> Map;
+    typedef PortBusOps<Gpio, Pins, 0> Ops;
+
+    static void pin(int pin, bool level)
+    {
+        Gpio::bsrr(Map::port(pin), level ? Map::bit(pin) : Map::bit(pin) << 16);
+    }
+
+    void write(bool cd, unsigned char value)
+    {
+        Ops::control(cd, false, true, false);
+        Ops::write(value);
+        Gpio::wait(LCD_PORT_STROBE_NS);
+        Ops::control(cd, true, true, true);
+    }
+
+    unsigned char read(bool cd)
+    {
+        unsigned char value;
+
+        Ops::direction(false);
+        Ops::control(cd, false, false, true);
+        Gpio::wait(LCD_PORT_STROBE_NS);
+        value = Ops::read();
+        Ops::control(cd, true, true, true);
+        Ops::direction(true);
+
+        return value;
+    }
+};
+
+#endif
@@ -0,0 +1,193 @@
+#include <string.h>
+#include "ShadowVram.h"
+
+// AUTO_RESET + REG_ADDR (2 data + command) + AUTO_WRITE
+#define SHADOW_READDRESS_COST 5
+
+ShadowVram::ShadowVram(T6963C &lcd) : _lcd(lcd), _mergeGap(SHADOW_READDRESS_COST)
+{
+    memset(_data, 0, sizeof(_data));
+    memset(_dirty, 0, sizeof(_dirty));
+    memset(&counters, 0, sizeof(counters));
+}
+
+bool ShadowVram::contains(int addr)
+{
+    return (addr >= VRAM_START && addr < VRAM_END) || (addr >= CGRAM_START && addr < CGRAM_END);
+}
+
+int ShadowVram::indexOf(int addr)
+{
+    if (addr >= CGRAM_START)
+        return SHADOW_VRAM_SIZE + (addr - CGRAM_START);
+    return addr - VRAM_START;
+}
+
+void ShadowVram::write(int addr, const unsigned char *data, int length)
+{
+    int i, index;
+
+    for (i = 0; i < length; i++)
+    {
+        if (!contains(addr + i))
+            continue;
+        index = indexOf(addr + i);
+        if (_data[index] != data[i])
+        {
+            _data[index] = data[i];
+            _dirty[index >> 5] |= 1UL << (index & 31);
+        }
+    }
+}
+
+void ShadowVram::fill(int addr, unsigned char value, int length)
+{
+    int i, index;
+
+    for (i = 0; i < length; i++)
+    {
+        if (!contains(addr + i))
+            continue;
+        index = indexOf(addr + i);
+        if (_data[index] != value)
+        {
+            _data[index] = value;
+            _dirty[index >> 5] |= 1UL << (index & 31);
+        }
+    }
+}
+
+unsigned char ShadowVram::read(int addr)
+{
+    if (!contains(addr))
+        return 0;
+    return _data[indexOf(addr)];
+}
+
+unsigned char *ShadowVram::buffer(int addr)
+{
+    if (!contains(addr))
+        return NULL;
+    return &_data[indexOf(addr)];
+}
+
+void ShadowVram::markDirty(int addr, int length)
+{
+    int i, index;
+
+    for (i = 0; i < length; i++)
+    {
+        if (!contains(addr + i))
+            continue;
+        index = indexOf(addr + i);
+        _dirty[index >> 5] |= 1UL << (index & 31);
+    }
+}
+
+void ShadowVram::markClean(int addr, int length)
+{
+    int i, index;
+
+    for (i = 0; i < length; i++)
+    {
+        if (!contains(addr + i))
+            continue;
+        index = indexOf(addr + i);
+        _dirty[index >> 5] &= ~(1UL << (index & 31));
+    }
+}
+
+bool ShadowVram::dirty(int addr)
+{
+    int index;
+
+    if (!contains(addr))
+        return false;
+    index = indexOf(addr);
+    return (_dirty[index >> 5] >> (index & 31)) & 1;
+}
+
+void ShadowVram::invalidate()
+{
+    memset(_dirty, 0xFF, sizeof(_dirty));
+}
+
+void ShadowVram::setMergeGap(int gap)
+{
+    _mergeGap = gap;
+}
+
+int ShadowVram::nextDirty(int from, int end)
+{
+    uint32_t word;
+
+    while (from < end)
+    {
+        word = _dirty[from >> 5] >> (from & 31);
+        if (word != 0)
+        {
+            from += __builtin_ctz(word);
+            return from < end ? from : end;
+        }
+        from = (from | 31) + 1;
+    }
+    return end;
+}
+
+int ShadowVram::nextClean(int from, int end)
+{
+    uint32_t word;
+
+    while (from < end)
+    {
+        word = ~_dirty[from >> 5] >> (from & 31);
+        if (word != 0)
+        {
+            from += __builtin_ctz(word);
+            return from < end ? from : end;
+        }
+        from = (from | 31) + 1;
+    }
+    return end;
+}
+
+// Send the dirty spans of [begin, end) (shadow indexes), base = VRAM address of index 0
+void ShadowVram::flushRegion(int begin, int end, int base)
+{
+    union convIntByte conv;
+    int start, stop, next, i;
+
+    start = nextDirty(begin, end);
+    while (start < end)
+    {
+        stop = nextClean(start, end);
+        next = nextDirty(stop, end);
+        while (next < end && next - stop <= _mergeGap)
+        {
+            stop = nextClean(next, end);
+            next = nextDirty(stop, end);
+        }
+
+        for (i = start; i < stop; i++)
+        {
+            if (_dirty[i >> 5] & (1UL << (i & 31)))
+                counters.dirtyBytes++;
+            _dirty[i >> 5] &= ~(1UL << (i & 31));
+        }
+        counters.spans++;
+        counters.bytes += stop - start;
+
+        conv.iData = base + start;
+        _lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+        _lcd.autoDataWrite(&_data[start], stop - start);
+
+        start = next;
+    }
+}
+
+void ShadowVram::flush()
+{
+    counters.flushes++;
+    flushRegion(0, SHADOW_VRAM_SIZE, VRAM_START);
+    flushRegion(SHADOW_VRAM_SIZE, SHADOW_SIZE, CGRAM_START - SHADOW_VRAM_SIZE);
+}
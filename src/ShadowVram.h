@@ -0,0 +1,102 @@
+#ifndef SHADOW_VRAM_H
+#define SHADOW_VRAM_H
+
+#include <stdint.h>
+#include "T6963C.h"
+#include "LcdLayout.h"
+
+#define SHADOW_VRAM_SIZE (VRAM_END - VRAM_START)    // text + graphics
+#define SHADOW_CGRAM_SIZE (CGRAM_END - CGRAM_START) // CGRAM
+#define SHADOW_SIZE (SHADOW_VRAM_SIZE + SHADOW_CGRAM_SIZE)
+
+/** Counters of ShadowVram::flush() */
+struct ShadowCounters {
+    unsigned long flushes;
+    unsigned long spans;      // REG_ADDR + AUTO_WRITE bursts
+    unsigned long bytes;      // bytes sent (including merged clean gaps)
+    unsigned long dirtyBytes; // bytes that actually changed
+};
+
+/** RAM copy of the text, graphics and CGRAM areas with dirty tracking
+ *
+ *  Drawing goes to RAM; only bytes that differ from the shadow are marked
+ *  dirty. flush() sends every dirty span with one REG_ADDR and one
+ *  AUTO_WRITE burst, merging spans whose clean gap is cheaper to resend
+ *  than to re-address. The shadow starts zeroed, i.e. in sync with the
+ *  text and graphics areas after memoryClear(VRAM_START, VRAM_END). CGRAM
+ *  is not cleared by it and holds power-up garbage: writers of CGRAM mark
+ *  what they upload dirty (see CgramAllocator), or call invalidate().
+ */
+class ShadowVram {
+  public:
+    /** Create a shadow of the areas defined in LcdLayout.h
+     *
+     *  @param lcd Display the shadow is flushed to
+     */
+    ShadowVram(T6963C &lcd);
+    virtual ~ShadowVram() {};
+
+    /** Write bytes at a VRAM address
+     *
+     *  Bytes outside the shadow (see contains()) are ignored here and in
+     *  fill() and markDirty().
+     *
+     *  @param addr VRAM address (text, graphics or CGRAM area)
+     *  @param data Source bytes
+     *  @param length Number of bytes
+     */
+    void write(int addr, const unsigned char *data, int length);
+
+    /** Fill bytes at a VRAM address with a value */
+    void fill(int addr, unsigned char value, int length);
+
+    /** Read one byte of the shadow (0 outside it) */
+    unsigned char read(int addr);
+
+    /** Pointer into the shadow for direct drawing; call markDirty() after
+     *
+     *  The text and graphics areas are contiguous, CGRAM follows them.
+     *
+     *  @returns NULL if the address is outside the shadow
+     */
+    unsigned char *buffer(int addr);
+
+    /** Force bytes to be sent on the next flush */
+    void markDirty(int addr, int length);
+
+    /** The display already holds these bytes (written around the shadow)
+     *
+     *  Addresses outside the shadow are ignored.
+     */
+    void markClean(int addr, int length);
+
+    /** true if a byte is waiting to be sent (false outside the shadow) */
+    bool dirty(int addr);
+
+    /** Forget the display contents: everything is sent on the next flush */
+    void invalidate();
+
+    /** Send all dirty spans to the display */
+    void flush();
+
+    /** Largest clean gap that is sent instead of re-addressing (bytes) */
+    void setMergeGap(int gap);
+
+    /** true if the address is covered by the shadow */
+    static bool contains(int addr);
+
+    ShadowCounters counters;
+
+  private:
+    static int indexOf(int addr);
+    int nextDirty(int from, int end);
+    int nextClean(int from, int end);
+    void flushRegion(int begin, int end, int base);
+
+    T6963C &_lcd;
+    int _mergeGap;
+    unsigned char _data[SHADOW_SIZE];
+    uint32_t _dirty[(SHADOW_SIZE + 31) / 32];
+};
+
+#endif
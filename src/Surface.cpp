@@ -0,0 +1,300 @@
+#include <string.h>
+#include "Surface.h"
+
+Surface::Surface(unsigned char *bits, int width, int height, int stride)
+    : _bits(bits), _width(width), _height(height), _stride(stride)
+{
+}
+
+// Combine src into the bits of d selected by mask
+static inline void apply(unsigned char *d, unsigned char src, unsigned char mask, RasterOp op)
+{
+    switch (op)
+    {
+    case ROP_OR:
+        *d |= src & mask;
+        break;
+    case ROP_XOR:
+        *d ^= src & mask;
+        break;
+    case ROP_AND:
+        *d &= src | ~mask;
+        break;
+    case ROP_CLEAR:
+        *d &= ~(src & mask);
+        break;
+    }
+}
+
+// Whole bytes of a solid span
+static void fillBytes(unsigned char *p, int count, RasterOp op)
+{
+    uint32_t word;
+
+    switch (op)
+    {
+    case ROP_OR:
+        memset(p, 0xFF, count);
+        break;
+    case ROP_CLEAR:
+        memset(p, 0x00, count);
+        break;
+    case ROP_AND:
+        break;
+    case ROP_XOR:
+        // a word at a time; memcpy keeps the byte buffer free of aliasing
+        // and alignment assumptions and compiles to plain loads and stores
+        for (; count >= 4; count -= 4, p += 4)
+        {
+            memcpy(&word, p, 4);
+            word ^= 0xFFFFFFFFUL;
+            memcpy(p, &word, 4);
+        }
+        for (; count > 0; count--)
+        {
+            *p++ ^= 0xFF;
+        }
+        break;
+    }
+}
+
+// Solid span [x0, x1] of one line (already clipped; x1 may run into the next lines)
+void Surface::span(unsigned char *row, int x0, int x1, RasterOp op)
+{
+    int b0 = x0 >> 3, b1 = x1 >> 3;
+    unsigned char m0 = 0xFF >> (x0 & 7);
+    unsigned char m1 = 0xFF << (7 - (x1 & 7));
+
+    if (b0 == b1)
+    {
+        apply(&row[b0], 0xFF, m0 & m1, op);
+        return;
+    }
+    apply(&row[b0], 0xFF, m0, op);
+    fillBytes(&row[b0 + 1], b1 - b0 - 1, op);
+    apply(&row[b1], 0xFF, m1, op);
+}
+
+void Surface::fill(RasterOp op)
+{
+    fillRect(0, 0, _width, _height, op);
+}
+
+void Surface::pixel(int x, int y, RasterOp op)
+{
+    if (x < 0 || y < 0 || x >= _width || y >= _height)
+        return;
+    apply(&_bits[y * _stride + (x >> 3)], 0xFF, 0x80 >> (x & 7), op);
+}
+
+bool Surface::getPixel(int x, int y)
+{
+    if (x < 0 || y < 0 || x >= _width || y >= _height)
+        return false;
+    return (_bits[y * _stride + (x >> 3)] >> (7 - (x & 7))) & 1;
+}
+
+void Surface::hline(int x0, int x1, int y, RasterOp op)
+{
+    int t;
+
+    if (x0 > x1)
+    {
+        t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if (y < 0 || y >= _height || x1 < 0 || x0 >= _width)
+        return;
+    if (x0 < 0)
+        x0 = 0;
+    if (x1 >= _width)
+        x1 = _width - 1;
+    span(&_bits[y * _stride], x0, x1, op);
+}
+
+void Surface::vline(int x, int y0, int y1, RasterOp op)
+{
+    unsigned char *p;
+    unsigned char mask;
+    int t;
+
+    if (y0 > y1)
+    {
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    if (x < 0 || x >= _width || y1 < 0 || y0 >= _height)
+        return;
+    if (y0 < 0)
+        y0 = 0;
+    if (y1 >= _height)
+        y1 = _height - 1;
+
+    p = &_bits[y0 * _stride + (x >> 3)];
+    mask = 0x80 >> (x & 7);
+    for (; y0 <= y1; y0++, p += _stride)
+    {
+        apply(p, 0xFF, mask, op);
+    }
+}
+
+void Surface::line(int x0, int y0, int x1, int y1, RasterOp op)
+{
+    int dx, dy, sx, sy, err, e2;
+
+    if (y0 == y1)
+    {
+        hline(x0, x1, y0, op);
+        return;
+    }
+    if (x0 == x1)
+    {
+        vline(x0, y0, y1, op);
+        return;
+    }
+
+    dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    dy = y1 > y0 ? y0 - y1 : y1 - y0; // negative
+    sx = x0 < x1 ? 1 : -1;
+    sy = y0 < y1 ? 1 : -1;
+    err = dx + dy;
+    while (1)
+    {
+        pixel(x0, y0, op);
+        if (x0 == x1 && y0 == y1)
+            break;
+        e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void Surface::rect(int x, int y, int w, int h, RasterOp op)
+{
+    if (w <= 0 || h <= 0)
+        return;
+    hline(x, x + w - 1, y, op);
+    if (h > 1)
+        hline(x, x + w - 1, y + h - 1, op);
+    if (h > 2)
+    {
+        vline(x, y + 1, y + h - 2, op);
+        if (w > 1)
+            vline(x + w - 1, y + 1, y + h - 2, op);
+    }
+}
+
+void Surface::fillRect(int x, int y, int w, int h, RasterOp op)
+{
+    int i;
+
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (x + w > _width)
+        w = _width - x;
+    if (y + h > _height)
+        h = _height - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    // full lines of a tightly packed surface are one span
+    if (x == 0 && w == _width && _stride * 8 == _width)
+    {
+        span(&_bits[y * _stride], 0, _width * h - 1, op);
+        return;
+    }
+    for (i = 0; i < h; i++)
+    {
+        span(&_bits[(y + i) * _stride], x, x + w - 1, op);
+    }
+}
+
+void Surface::blit(int x, int y, const unsigned char *src, int w, int h, int srcStride, RasterOp op)
+{
+    const unsigned char *s;
+    unsigned char *d;
+    unsigned char mask, bits;
+    int sx = 0, sy = 0;
+    int i, k, b0, b1, p, last, shift;
+
+    if (x < 0)
+    {
+        sx = -x;
+        w += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        sy = -y;
+        h += y;
+        y = 0;
+    }
+    if (x + w > _width)
+        w = _width - x;
+    if (y + h > _height)
+        h = _height - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    b0 = x >> 3;
+    b1 = (x + w - 1) >> 3;
+    last = (sx + w - 1) >> 3; // last source byte used
+    for (i = 0; i < h; i++)
+    {
+        s = src + (sy + i) * srcStride;
+        d = &_bits[(y + i) * _stride];
+
+        // byte aligned: source bytes map 1:1 to destination bytes
+        if ((x & 7) == 0 && (sx & 7) == 0)
+        {
+            s += sx >> 3;
+            for (k = b0; k < b1; k++)
+            {
+                apply(&d[k], *s++, 0xFF, op);
+            }
+            apply(&d[b1], *s, 0xFF << (7 - ((x + w - 1) & 7)), op);
+            continue;
+        }
+
+        // shift and merge: destination byte k takes source bits from p
+        for (k = b0; k <= b1; k++)
+        {
+            p = sx + k * 8 - x;
+            if (p < 0)
+            {
+                bits = s[0] >> -p;
+            }
+            else
+            {
+                shift = p & 7;
+                bits = s[p >> 3] << shift;
+                if (shift != 0 && (p >> 3) < last)
+                    bits |= s[(p >> 3) + 1] >> (8 - shift);
+            }
+            mask = 0xFF;
+            if (k == b0)
+                mask &= 0xFF >> (x & 7);
+            if (k == b1)
+                mask &= 0xFF << (7 - ((x + w - 1) & 7));
+            apply(&d[k], bits, mask, op);
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#ifndef SURFACE_H
+#define SURFACE_H
+
+#include <stdint.h>
+
+/** Raster operations, as the T6963C MODE_OR / MODE_EXOR / MODE_AND combine layers */
+enum RasterOp {
+    ROP_OR,    // dst |= src (set pixels)
+    ROP_XOR,   // dst ^= src (invert pixels)
+    ROP_AND,   // dst &= src (keep pixels where src is set)
+    ROP_CLEAR, // dst &= ~src (clear pixels)
+};
+
+/** Packed 1 bpp drawing surface in RAM
+ *
+ *  Pixels are stored like the T6963C graphics area: `stride` bytes per
+ *  line, MSB = leftmost pixel. A surface can wrap a DoubleBuffer frame
+ *  (Surface(frames.graphics(), DISPLAY_WIDTH * 8, DISPLAY_HEIGHT * 8,
+ *  DISPLAY_WIDTH)) or any other buffer. Everything is clipped to the
+ *  surface.
+ *
+ *  Primitives draw with a solid source, so within the shape ROP_OR sets,
+ *  ROP_XOR inverts, ROP_CLEAR clears and ROP_AND keeps the pixels. Spans
+ *  handle the partial bytes at both ends with masks and fill the bytes in
+ *  between whole (32 bits at a time for XOR).
+ */
+class Surface {
+  public:
+    /** Create a surface on a buffer
+     *
+     *  @param bits Pixel buffer (stride * height bytes)
+     *  @param width Width in pixels
+     *  @param height Height in pixels
+     *  @param stride Bytes per line
+     */
+    Surface(unsigned char *bits, int width, int height, int stride);
+    virtual ~Surface() {};
+
+    unsigned char *bits() { return _bits; }
+    int width() { return _width; }
+    int height() { return _height; }
+    int stride() { return _stride; }
+
+    /** Apply an operation to every pixel */
+    void fill(RasterOp op);
+
+    void pixel(int x, int y, RasterOp op = ROP_OR);
+    bool getPixel(int x, int y);
+
+    /** Horizontal span [x0, x1] on line y */
+    void hline(int x0, int x1, int y, RasterOp op = ROP_OR);
+
+    /** Vertical span [y0, y1] in column x */
+    void vline(int x, int y0, int y1, RasterOp op = ROP_OR);
+
+    /** Line between two points (Bresenham) */
+    void line(int x0, int y0, int x1, int y1, RasterOp op = ROP_OR);
+
+    /** Outline of a w x h rectangle */
+    void rect(int x, int y, int w, int h, RasterOp op = ROP_OR);
+
+    /** Filled w x h rectangle */
+    void fillRect(int x, int y, int w, int h, RasterOp op = ROP_OR);
+
+    /** Combine a 1 bpp bitmap into the surface
+     *
+     *  @param x Left edge (any pixel position)
+     *  @param y Top edge
+     *  @param src Bitmap, MSB = leftmost pixel
+     *  @param w Width in pixels
+     *  @param h Height in pixels
+     *  @param srcStride Bytes per bitmap line
+     *  @param op Raster operation (ROP_AND clears where src is 0)
+     */
+    void blit(int x, int y, const unsigned char *src, int w, int h, int srcStride, RasterOp op = ROP_OR);
+
+  private:
+    void span(unsigned char *row, int x0, int x1, RasterOp op);
+
+    unsigned char *_bits;
+    int _width;
+    int _height;
+    int _stride;
+};
+
+#endif
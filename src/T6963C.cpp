@@ -0,0 +1,445 @@
+#include <stdio.h>
+#include <string.h>
+#include "T6963C.h"
+#include "BusTrace.h"
+
+T6963C::T6963C(LcdBus &bus) : _bus(bus)
+{
+    _writeDelayNs = 0;
+    _autoWrite = false;
+    invalidate();
+    clearCounters();
+}
+
+void T6963C::reset()
+{
+    // printf("Resetting...");
+    fflush(stdout);
+    _bus.reset();
+    _autoWrite = false;
+    invalidate();
+    // printf("Done!\n");
+}
+
+union statusCode T6963C::statusRead()
+{
+    union statusCode stcd;
+    stcd.usData = 0;
+
+    stcd.usData = _bus.readStatus();
+    // printf("%2x ", stcd.usData);
+    return stcd;
+}
+
+void T6963C::waitForWrite()
+{
+    union statusCode stcd;
+    unsigned int polls = 0;
+    TRACE_START(traceStart);
+
+    // no status/data access in auto mode
+    flush();
+
+    // printf("Waiting for write...");
+    fflush(stdout);
+
+    while (1)
+    {
+        stcd.usData = statusRead().usData;
+        polls++;
+
+        if ((stcd.tBit.comEn == 1 && /* stcd.tBit.lcdcEn == 1 && */ stcd.tBit.rwEn == 1))
+            break;
+    }
+    TRACE_RECORD(TRACE_STATUS_WAIT, TRACE_WAIT_WRITE, polls, traceStart);
+    // printf("Done!\n");
+    fflush(stdout);
+}
+
+void T6963C::waitForAutoWrite()
+{
+    union statusCode stcd;
+    unsigned int polls = 0;
+    TRACE_START(traceStart);
+    // printf("Waiting for auto write...");
+    fflush(stdout);
+
+    while (1)
+    {
+
+        stcd.usData = statusRead().usData;
+        polls++;
+        if ((stcd.tBit.comEn == 1 && /* stcd.tBit.lcdcEn == 1 &&  */ stcd.tBit.aWR == 1))
+            break;
+    }
+    TRACE_RECORD(TRACE_STATUS_WAIT, TRACE_WAIT_AUTO_WRITE, polls, traceStart);
+    // printf("Done!\n");
+    fflush(stdout);
+}
+void T6963C::waitForAutoRead()
+{
+    union statusCode stcd;
+    unsigned int polls = 0;
+    TRACE_START(traceStart);
+    // printf("Waiting for auto read...");
+    fflush(stdout);
+    while (1)
+    {
+        stcd.usData = statusRead().usData;
+        polls++;
+        if ((stcd.tBit.comEn == 1 && /*  stcd.tBit.lcdcEn == 1 &&  */ stcd.tBit.aRD == 1))
+            break;
+    }
+    TRACE_RECORD(TRACE_STATUS_WAIT, TRACE_WAIT_AUTO_READ, polls, traceStart);
+    // printf("Done!\n");
+    fflush(stdout);
+}
+
+void T6963C::dataWrite2Bytes(unsigned char command, unsigned char ldata, unsigned char hdata)
+{
+    int *cached = registerCache(command);
+    int value = ldata | (hdata << 8);
+    TRACE_START(traceStart);
+
+    if (cached != NULL)
+    {
+        if (*cached == value)
+        {
+            if (command == REG_ADDR)
+                counters.elidedAddresses++;
+            else
+                counters.elidedRegisters++;
+            return;
+        }
+        *cached = value;
+    }
+    // printf("Data Write CMD=0x%02x DATA=0x%02x 0x%02x\n", command, hdata, ldata);
+    fflush(stdout);
+    waitForWrite();
+    _bus.writeData(ldata);
+
+    waitForWrite();
+    _bus.writeData(hdata);
+
+    waitForWrite();
+    _bus.writeCommand(command);
+    TRACE_RECORD(TRACE_COMMAND, command, 2, traceStart);
+}
+
+void T6963C::dataWriteByte(unsigned char command, unsigned char data)
+{
+    TRACE_START(traceStart);
+    // printf("Data Write CMD=0x%02x DATA=0x%02x\n", command, data);
+    fflush(stdout);
+    waitForWrite();
+    _bus.writeData(data);
+
+    waitForWrite();
+    _bus.writeCommand(command);
+    advance(command, 1);
+    TRACE_RECORD(TRACE_COMMAND, command, 1, traceStart);
+}
+
+void T6963C::autoDataRead(unsigned char *dataArray, int length)
+{
+    int i;
+    TRACE_START(traceStart);
+
+    waitForWrite();
+    _bus.writeCommand(AUTO_READ);
+
+    for (i = 0; i < length; i++)
+    {
+        waitForAutoRead();
+        dataArray[i] = _bus.readData();
+    }
+    waitForAutoRead();
+    _bus.writeCommand(AUTO_RESET);
+    if (_addr >= 0)
+        _addr = (_addr + length) & 0xFFFF;
+    TRACE_RECORD(TRACE_READ_BURST, AUTO_READ, length, traceStart);
+
+    // printf("Read data is...\n");
+
+    // for (i = 0; i < length; i++)
+    // {
+    //     printf("%02x ", dataArray[i]);
+    //     if (i % 16 == 0)
+    //         printf("\n");
+    // }
+    // printf("\n");
+}
+
+void T6963C::autoDataWrite(const unsigned char *dataArray, int length)
+{
+    TRACE_START(traceStart);
+    autoWrite(dataArray, 0, length);
+    TRACE_RECORD(TRACE_WRITE_BURST, AUTO_WRITE, length, traceStart);
+}
+void T6963C::memoryClear(int from, int to)
+{
+    memoryFill(from, to, 0);
+}
+
+void T6963C::memoryFill(int from, int to, unsigned char value)
+{
+    union convIntByte conv;
+    TRACE_START(traceStart);
+    // printf("Memory Clear...");
+
+    conv.iData = from;
+
+    dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+    autoWrite(NULL, value, to - from);
+    TRACE_RECORD(TRACE_WRITE_BURST, AUTO_WRITE, to - from, traceStart);
+}
+
+int T6963C::calibrate(int addr, int length)
+{
+    union convIntByte conv;
+    union statusCode stcd;
+    unsigned int delayNs = 0;
+    int i, ready = 0;
+
+    _writeDelayNs = 0;
+    conv.iData = addr;
+    dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+    flush();
+    waitForWrite();
+    _bus.writeCommand(AUTO_WRITE);
+    _autoWrite = true;
+    waitForAutoWrite();
+
+    // write, wait, poll once: lengthen the wait until the first poll is
+    // ready LCD_CALIBRATE_SAMPLES times in a row
+    for (i = 0; i < length; i++)
+    {
+        _bus.writeData(0);
+        _bus.delay(delayNs);
+        stcd = statusRead();
+        if (stcd.tBit.comEn == 1 && stcd.tBit.aWR == 1)
+        {
+            ready++;
+            continue;
+        }
+        ready = 0;
+        delayNs += LCD_CALIBRATE_STEP_NS;
+        waitForAutoWrite();
+    }
+    _addr = (addr + length) & 0xFFFF;
+
+    if (ready >= LCD_CALIBRATE_SAMPLES)
+        _writeDelayNs = delayNs + delayNs / 4 + LCD_CALIBRATE_STEP_NS;
+    return _writeDelayNs;
+}
+
+// Bytes of an AUTO_WRITE burst: from data, or value if data is NULL
+void T6963C::autoWrite(const unsigned char *data, unsigned char value, int length)
+{
+    union convIntByte conv;
+    union statusCode stcd;
+    bool merged = _autoWrite;
+    int start = _addr;
+    int i;
+
+    if (merged)
+    {
+        counters.mergedBursts++;
+    }
+    else
+    {
+        waitForWrite();
+        _bus.writeCommand(AUTO_WRITE);
+        _autoWrite = true;
+    }
+
+    for (i = 0; i < length; i++)
+    {
+        // timed: the controller was ready at the end of the previous burst,
+        // only AUTO_WRITE itself is polled
+        if (_writeDelayNs == 0 || (i == 0 && !merged))
+            waitForAutoWrite();
+        else if (i != 0)
+            _bus.delay(_writeDelayNs);
+        // printf("Write data is... %02x\n", data[i]);
+
+        _bus.writeData(data != NULL ? data[i] : value);
+    }
+    if (_addr >= 0)
+        _addr = (_addr + length) & 0xFFFF;
+
+    // burst boundary: the calibrated wait must have been enough
+    if (_writeDelayNs != 0 && length != 0)
+    {
+        _bus.delay(_writeDelayNs);
+        stcd = statusRead();
+        if (stcd.tBit.comEn == 0 || stcd.tBit.aWR == 0 || stcd.tBit.error == 1)
+        {
+            counters.fallbacks++;
+            _writeDelayNs = 0;
+            waitForAutoWrite();
+            if (start < 0)
+            {
+                counters.lostBursts++;
+                return;
+            }
+            // bytes of this burst may have been dropped: write it again, polled
+            flush();
+            conv.iData = start;
+            dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+            autoWrite(data, value, length);
+        }
+    }
+}
+
+unsigned char T6963C::dataRead(unsigned char command)
+{
+    unsigned char data;
+    TRACE_START(traceStart);
+    waitForWrite();
+    _bus.writeCommand(command);
+
+    waitForWrite();
+    data = _bus.readData();
+    advance(command, 1);
+
+    // printf("Data Write CMD=0x%02x DATA=0x%02x\n", command, data);
+
+    TRACE_RECORD(TRACE_COMMAND, command, 0, traceStart);
+    return data;
+}
+
+void T6963C::lcdPutc(char chr)
+{
+    dataWriteByte(DATA_WRITE_UP, chr >= ' ' ? chr - ' ' : 0);
+}
+
+void T6963C::lcdPuts(unsigned char *str)
+{
+    unsigned int i = 0;
+    for (i = 0; i < strlen((char *)str); i++)
+    {
+        dataWriteByte(DATA_WRITE_UP, str[i] >= ' ' ? str[i] - ' ' : 0);
+    }
+}
+
+void T6963C::commandSet(unsigned char command)
+{
+    int *cached = NULL;
+    TRACE_START(traceStart);
+
+    if ((command & 0xF0) == MODE_SET)
+        cached = &_mode;
+    else if ((command & 0xF0) == ENA_BASE)
+        cached = &_display;
+    else if ((command & 0xF8) == CURSOR_BASE)
+        cached = &_cursorLines;
+    else if (command == AUTO_RESET && _autoWrite)
+    {
+        flush();
+        return;
+    }
+    if (cached != NULL)
+    {
+        if (*cached == command)
+        {
+            counters.elidedCommands++;
+            return;
+        }
+        *cached = command;
+    }
+
+    // printf("Sending Command CMD=0x%02x\n", command);
+    waitForWrite();
+    _bus.writeCommand(command);
+    if (command == AUTO_WRITE || command == AUTO_READ)
+        _addr = -1; // bytes are sent behind the driver's back
+    TRACE_RECORD(TRACE_COMMAND, command, 0, traceStart);
+}
+
+void T6963C::flush()
+{
+    if (!_autoWrite)
+        return;
+    _autoWrite = false;
+    waitForAutoWrite();
+    _bus.writeCommand(AUTO_RESET);
+}
+
+void T6963C::invalidate()
+{
+    _addr = -1;
+    _cursor = -1;
+    _offset = -1;
+    _textHome = -1;
+    _textWidth = -1;
+    _grphHome = -1;
+    _grphWidth = -1;
+    _mode = -1;
+    _display = -1;
+    _cursorLines = -1;
+}
+
+void T6963C::clearCounters()
+{
+    counters.elidedAddresses = 0;
+    counters.elidedRegisters = 0;
+    counters.elidedCommands = 0;
+    counters.mergedBursts = 0;
+    counters.fallbacks = 0;
+    counters.lostBursts = 0;
+}
+
+int T6963C::cachedState(unsigned char command)
+{
+    int *cached = registerCache(command);
+
+    if (cached != NULL)
+        return *cached;
+    if (command == MODE_SET)
+        return _mode;
+    if (command == ENA_BASE)
+        return _display;
+    if (command == CURSOR_BASE)
+        return _cursorLines;
+    return -1;
+}
+
+// Cached value of a two byte register, NULL for other commands
+int *T6963C::registerCache(unsigned char command)
+{
+    switch (command)
+    {
+    case REG_CURSOR:
+        return &_cursor;
+    case REG_OFFSET:
+        return &_offset;
+    case REG_ADDR:
+        return &_addr;
+    case DISP_TEXT_HOME_ADDR:
+        return &_textHome;
+    case DISP_TEXT_WIDTH:
+        return &_textWidth;
+    case DISP_GRPH_HOME_ADDR:
+        return &_grphHome;
+    case DISP_GRPH_WIDTH:
+        return &_grphWidth;
+    default:
+        return NULL;
+    }
+}
+
+// Address pointer after a single byte command
+void T6963C::advance(unsigned char command, int length)
+{
+    int *cached = registerCache(command);
+
+    if (cached != NULL)
+        *cached = -1; // register set from one data byte: the other is unknown
+    else if (_addr < 0)
+        return;
+    else if (command == DATA_WRITE_UP || command == DATA_READ_UP)
+        _addr = (_addr + length) & 0xFFFF;
+    else if (command == DATA_WRITE_DOWN || command == DATA_READ_DOWN)
+        _addr = (_addr - length) & 0xFFFF;
+}
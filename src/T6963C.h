@@ -0,0 +1,205 @@
+#ifndef T6963C_H
+#define T6963C_H
+
+#include "LcdBus.h"
+
+// calibrate(): wait step and consecutive first-poll-ready writes required
+#ifndef LCD_CALIBRATE_STEP_NS
+#define LCD_CALIBRATE_STEP_NS 50
+#endif
+#ifndef LCD_CALIBRATE_SAMPLES
+#define LCD_CALIBRATE_SAMPLES 16
+#endif
+
+union statusCode {
+    unsigned int usData;
+    struct
+    {
+        unsigned int comEn : 1;  // コマンド実行可能か？ 1=実行可 0=実行不可
+        unsigned int rwEn : 1;   // データリード・ライト可能か？ 1=実行可 0=実行不可
+        unsigned int aRD : 1;    // オートデータリード可能か？ 1=実行可 0=実行不可
+        unsigned int aWR : 1;    // オートデータライト可能か？ 1=実行可 0=実行不可
+        unsigned int dummy : 1;  // 未使用
+        unsigned int lcdcEn : 1; // LCDC動作可能か？ 1=動作可 0=動作不可
+        unsigned int error : 1;  // エラーフラグ 1=エラー 0=正常
+        unsigned int blink : 1;  // ブリンクフラグ 1=表示 0=非表示
+    } tBit;
+};
+
+union convIntByte {
+    int iData;
+    unsigned char ucData[2];
+};
+
+union convUShortByte {
+    unsigned short usData;
+    unsigned char ucData[2];
+};
+
+enum Commands
+{
+    // レジスタセット
+    REG_CURSOR = 0x21, // カーソルポインタセット X,Y
+    REG_OFFSET,        // オフセットレジスタセット Data,00H
+    REG_ADDR = 0x24,   // アドレスポインタセット lData,HData
+
+    // 画面設定
+    DISP_TEXT_HOME_ADDR = 0x40, // 表示テキストホームアドレスセット lData,HData
+    DISP_TEXT_WIDTH,            // テキストエリア桁数指定 Data,00H
+    DISP_GRPH_HOME_ADDR,        // 表示グラフィックホームアドレスセット lData,HData
+    DISP_GRPH_WIDTH,            // グラフィックエリア桁数指定 Data,00H
+
+    // モードセット
+    MODE_SET = 0x80,       // モードセット
+    MODE_OR = 0x00,        // 表示ORモード MODE_SETに足し込むこと
+    MODE_EXOR = 0x01,      // 表示EXORモード MODE_SETに足し込むこと
+    MODE_AND = 0x03,       // 表示ANDモード MODE_SETに足し込むこと
+    MODE_TEXT_ATTR = 0x04, // テキストアトリビュート MODE_SETに足し込むこと
+    MODE_INT_CG = 0x00,    // 内部CGモード MODE_SETに足し込むこと
+    MODE_EXT_CG = 0x08,    // 外部CGモード MODE_SETに足し込むこと
+
+    // 表示イネーブル
+    ENA_BASE = 0x90,            // 表示イネーブル 単体使用で"表示禁止"
+    ENA_CURSOR_NOTBLINK = 0x02, // カーソル表示ブリンク禁止 ENA_BASEに足し込むこと
+    ENA_CURSOR_BLINK = 0x03,    // カーソル表示ブリンクあり ENA_BASEに足し込むこと
+    ENA_TEXTONLY = 0x04,        // テキスト表示グラフィック禁止  ENA_BASEに足し込むこと
+    ENA_GRPHONLY = 0x08,        // グラフィック表示テキスト禁止 ENA_BASEに足し込むこと
+    ENA_TEXTGRPH = 0x0C,        // テキスト・グラフィック表示   ENA_BASEに足し込むこと
+
+    // カーソル指定
+    CURSOR_BASE = 0xA0, // n+1ラインカーソル (n=0～7(1ライン～8ライン)、足し込む)
+
+    // オート指定
+    AUTO_WRITE = 0xB0, // データオートライトセット
+    AUTO_READ,         // データオートリードセット
+    AUTO_RESET,        // オートリセット(オート指定解除)
+
+    // データＲ／Ｗ
+    DATA_WRITE_UP = 0xC0, // データライトアップ data
+    DATA_READ_UP,         // データリードアップ
+    DATA_WRITE_DOWN,      // データライトダウン data
+    DATA_READ_DOWN,       // データリードダウン
+    DATA_WRITE,           // データライト data
+    DATA_READ,            // データリード
+
+    // スクリーンピーク(多分使えない)
+    SCR_PEEK = 0xE0,
+
+    // スクリーンコピー(多分使えない)
+    SCR_COPY = 0xE8
+
+};
+
+// テキストアトリビュート (MODE_TEXT_ATTR時、グラフィックエリアに1文字1バイト)
+enum Attributes
+{
+    ATTR_NORMAL = 0x00,  // 通常表示
+    ATTR_INHIBIT = 0x03, // 表示禁止
+    ATTR_REVERSE = 0x05, // 反転表示
+    ATTR_BLINK = 0x08,   // ブリンク ATTR_NORMAL/INHIBIT/REVERSEに足し込むこと
+    ATTR_MODE_MASK = 0x07
+};
+
+/** Commands the driver did not send because they would not change state,
+ *  and timed writes that had to fall back to polling
+ */
+struct T6963CCounters {
+    unsigned long elidedAddresses; // REG_ADDR to where the pointer already is
+    unsigned long elidedRegisters; // other two byte registers already set
+    unsigned long elidedCommands;  // MODE_SET, ENA_BASE, CURSOR_BASE already set
+    unsigned long mergedBursts;    // AUTO_WRITE bursts continued without AUTO_RESET
+    unsigned long fallbacks;       // timed bursts not ready at the boundary check (resent polled)
+    unsigned long lostBursts;      // of those, bursts to an unknown address that could not be resent
+};
+
+/** T6963C driver with a cache of the controller state
+ *
+ *  The driver tracks the address pointer (including the auto-increment of
+ *  DATA_WRITE_UP and the auto modes), the registers, the mode and the
+ *  display enable state. Setting a register or mode to its current value
+ *  sends nothing. An AUTO_WRITE burst is left open, so a following burst
+ *  to the next address continues it; any other access closes it first.
+ *
+ *  After calibrate() the bytes of an AUTO_WRITE burst are written after a
+ *  fixed wait instead of a status poll each; status is only read at the
+ *  burst boundaries. A boundary check that finds the controller still busy
+ *  returns the driver to polling every byte and writes the burst again
+ *  from its start address, since some of its bytes may have been dropped.
+ */
+class T6963C {
+  public:
+    /** Create a T6963C driver on the specified bus
+     *
+     *  @param bus Parallel bus the controller is connected to
+     */
+    T6963C(LcdBus &bus);
+    virtual ~T6963C() {};
+
+    void reset();
+    union statusCode statusRead();
+    void waitForWrite();
+    void waitForAutoRead();
+    void waitForAutoWrite();
+    void dataWrite2Bytes(unsigned char command, unsigned char ldata, unsigned char hdata);
+    void dataWriteByte(unsigned char command, unsigned char data);
+    void autoDataRead(unsigned char *dataArray, int length);
+    void autoDataWrite(const unsigned char *dataArray, int length);
+    unsigned char dataRead(unsigned char command);
+    void memoryClear(int from, int to);
+    void memoryFill(int from, int to, unsigned char value);
+    void commandSet(unsigned char command);
+    void lcdPutc(char chr);
+    void lcdPuts(unsigned char *str);
+
+    /** Measure the auto write busy time and switch to timed bursts
+     *
+     *  Writes zeros with AUTO_WRITE, so call it at startup before the memory
+     *  is cleared.
+     *
+     *  @param addr VRAM address of the calibration burst
+     *  @param length Bytes written (LCD_CALIBRATE_SAMPLES plus one per wait step)
+     *  @returns Wait between bytes in ns, 0 if the driver keeps polling
+     */
+    int calibrate(int addr, int length);
+
+    /** Close an open AUTO_WRITE burst */
+    void flush();
+
+    /** Forget the cached controller state, e.g. after another driver accessed the bus */
+    void invalidate();
+
+    /** Cached value of a register or mode, -1 if unknown
+     *
+     *  @param command REG_CURSOR, REG_OFFSET, REG_ADDR, DISP_*, MODE_SET, ENA_BASE or CURSOR_BASE
+     *  @return Register value, or the last MODE_SET / ENA_BASE / CURSOR_BASE command sent
+     */
+    int cachedState(unsigned char command);
+
+    void clearCounters();
+
+    T6963CCounters counters;
+
+  private:
+    int *registerCache(unsigned char command);
+    void advance(unsigned char command, int length);
+    void autoWrite(const unsigned char *data, unsigned char value, int length);
+
+    LcdBus &_bus;
+
+    // cached controller state, -1 = unknown
+    int _addr;
+    int _cursor;
+    int _offset;
+    int _textHome;
+    int _textWidth;
+    int _grphHome;
+    int _grphWidth;
+    int _mode;
+    int _display;
+    int _cursorLines;
+    bool _autoWrite;
+
+    unsigned int _writeDelayNs; // timed bursts, 0 = poll every byte
+};
+
+#endif
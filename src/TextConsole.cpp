@@ -0,0 +1,131 @@
+#include <string.h>
+#include "TextConsole.h"
+
+#define CONSOLE_STRIP (DISPLAY_WIDTH * 8) // graphics bytes behind one text row
+
+TextConsole::TextConsole(T6963C &lcd, bool scrollGraphics) : _lcd(lcd), _scrollGraphics(scrollGraphics)
+{
+    _line = 0;
+    _column = 0;
+    memset(&counters, 0, sizeof(counters));
+}
+
+void TextConsole::begin()
+{
+    _lcd.memoryFill(VRAM_CONSOLE_TEXT_ADDR, VRAM_CONSOLE_TEXT_ADDR + CONSOLE_ROWS * DISPLAY_WIDTH, 0);
+    if (_scrollGraphics)
+        _lcd.memoryFill(VRAM_CONSOLE_GRPH_ADDR, VRAM_CONSOLE_END, 0);
+    _line = 0;
+    _column = 0;
+    setHome();
+}
+
+void TextConsole::end()
+{
+    union convIntByte conv;
+
+    conv.iData = VRAM_TEXT_ADDR;
+    _lcd.dataWrite2Bytes(DISP_TEXT_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    if (_scrollGraphics)
+    {
+        conv.iData = VRAM_GRPH_ADDR;
+        _lcd.dataWrite2Bytes(DISP_GRPH_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    }
+}
+
+// Top row of the window in the ring
+void TextConsole::setHome()
+{
+    union convIntByte conv;
+    int top = _line < DISPLAY_HEIGHT ? 0 : (_line - DISPLAY_HEIGHT + 1) % CONSOLE_RING_ROWS;
+
+    conv.iData = VRAM_CONSOLE_TEXT_ADDR + top * DISPLAY_WIDTH;
+    _lcd.dataWrite2Bytes(DISP_TEXT_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    if (_scrollGraphics)
+    {
+        conv.iData = VRAM_CONSOLE_GRPH_ADDR + top * CONSOLE_STRIP;
+        _lcd.dataWrite2Bytes(DISP_GRPH_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    }
+}
+
+// Write codes into a ring row and its mirror
+void TextConsole::writeRow(int position, int column, const unsigned char *codes, int length)
+{
+    union convIntByte conv;
+
+    do
+    {
+        conv.iData = VRAM_CONSOLE_TEXT_ADDR + position * DISPLAY_WIDTH + column;
+        _lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+        _lcd.autoDataWrite(codes, length);
+        counters.bytes += length;
+        position += CONSOLE_RING_ROWS;
+    } while (position < CONSOLE_ROWS);
+}
+
+void TextConsole::clearRow(int position)
+{
+    int address;
+
+    do
+    {
+        address = VRAM_CONSOLE_TEXT_ADDR + position * DISPLAY_WIDTH;
+        _lcd.memoryFill(address, address + DISPLAY_WIDTH, 0);
+        counters.bytes += DISPLAY_WIDTH;
+        if (_scrollGraphics)
+        {
+            address = VRAM_CONSOLE_GRPH_ADDR + position * CONSOLE_STRIP;
+            _lcd.memoryFill(address, address + CONSOLE_STRIP, 0);
+            counters.bytes += CONSOLE_STRIP;
+        }
+        position += CONSOLE_RING_ROWS;
+    } while (position < CONSOLE_ROWS);
+}
+
+void TextConsole::newline()
+{
+    _line++;
+    _column = 0;
+    counters.lines++;
+    // the spare ring row: off screen until the home address moves onto it
+    clearRow(_line % CONSOLE_RING_ROWS);
+    if (_line >= DISPLAY_HEIGHT)
+    {
+        setHome();
+        counters.scrolls++;
+    }
+}
+
+void TextConsole::putc(char chr)
+{
+    char str[2] = {chr, 0};
+
+    puts(str);
+}
+
+void TextConsole::puts(const char *str)
+{
+    unsigned char run[DISPLAY_WIDTH];
+    int start = _column, length = 0;
+
+    for (; *str; str++)
+    {
+        if (*str == '\n' || *str == '\r' || _column == DISPLAY_WIDTH)
+        {
+            if (length != 0)
+                writeRow(_line % CONSOLE_RING_ROWS, start, run, length);
+            length = 0;
+            if (*str == '\r')
+                _column = 0;
+            else
+                newline();
+            start = _column;
+            if (*str == '\n' || *str == '\r')
+                continue;
+        }
+        run[length++] = *str >= ' ' ? *str - ' ' : 0;
+        _column++;
+    }
+    if (length != 0)
+        writeRow(_line % CONSOLE_RING_ROWS, start, run, length);
+}
@@ -0,0 +1,61 @@
+#ifndef TEXT_CONSOLE_H
+#define TEXT_CONSOLE_H
+
+#include "T6963C.h"
+#include "LcdLayout.h"
+
+/** Counters of a TextConsole */
+struct TextConsoleCounters {
+    unsigned long lines;  // lines started (newline or wrap)
+    unsigned long scrolls; // home address moves
+    unsigned long bytes;   // text and graphics bytes written
+};
+
+/** Scrolling text console with O(1) hardware scrolling
+ *
+ *  Lines go to a ring of CONSOLE_RING_ROWS text rows (LcdLayout.h) and the
+ *  console scrolls by moving DISP_TEXT_HOME_ADDR one row, so a scroll
+ *  writes only the newly exposed line instead of the whole text plane.
+ *  Rows at the start of the ring are also written to the mirror rows after
+ *  it, so the DISPLAY_HEIGHT rows after any home address are always
+ *  contiguous and the ring wraps without copying. With scrollGraphics the
+ *  graphics home follows in a ring of its own and each exposed row strip
+ *  is cleared.
+ *
+ *  Characters are ASCII as with T6963C::lcdPutc(); lines longer than
+ *  DISPLAY_WIDTH wrap, '\n' starts a new line and '\r' returns to column 0.
+ */
+class TextConsole {
+  public:
+    /** Create a console
+     *
+     *  @param lcd Display the console writes to
+     *  @param scrollGraphics true to scroll the graphics layer along
+     */
+    TextConsole(T6963C &lcd, bool scrollGraphics = false);
+    virtual ~TextConsole() {};
+
+    /** Clear the ring and point the home address(es) at it */
+    void begin();
+
+    /** Point the home address(es) back at VRAM_TEXT_ADDR / VRAM_GRPH_ADDR */
+    void end();
+
+    void putc(char chr);
+    void puts(const char *str);
+
+    TextConsoleCounters counters;
+
+  private:
+    void newline();
+    void writeRow(int position, int column, const unsigned char *codes, int length);
+    void clearRow(int position);
+    void setHome();
+
+    T6963C &_lcd;
+    bool _scrollGraphics;
+    unsigned long _line; // lines started since begin()
+    int _column;
+};
+
+#endif
@@ -0,0 +1,300 @@
+#include <string.h>
+#include "TextLayout.h"
+#include "Utf8Kuten.h"
+
+#define CODE_NEWLINE 0x000A // '\n' in a Layout (not a glyph)
+
+// JIS X 0208 row 1 (punctuation) that must not start a line:
+// 、。，．・：；？！゛゜ヽヾゝゞ々ー’”）〕］｝〉》」』】 and …‥ (never split from the text before)
+static const unsigned char noStartRow1[] = {2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 19, 20, 21, 22,
+                                            25, 28, 36, 37, 39, 41, 43, 45, 47, 49, 51, 53, 55, 57, 59};
+// Row 1 that must not end a line: ‘“（〔［｛〈《「『【
+static const unsigned char noEndRow1[] = {38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58};
+// Small kana (rows 4 and 5): ぁぃぅぇぉっゃゅょゎ ァィゥェォッャュョヮヵヶ
+static const unsigned char smallKana[] = {1, 3, 5, 7, 9, 35, 67, 69, 71, 78, 85, 86};
+
+static bool inSet(const unsigned char *set, int size, int ten)
+{
+    int i;
+
+    for (i = 0; i < size; i++)
+    {
+        if (set[i] == ten)
+            return true;
+    }
+    return false;
+}
+
+static bool isSpace(unsigned short code)
+{
+    return code == ' ' || code == 0x0101;
+}
+
+// ASCII that belongs to a word (broken only at spaces)
+static bool isWord(unsigned short code)
+{
+    return code > ' ' && code < 0x7F;
+}
+
+static bool noStart(unsigned short code)
+{
+    int ku = code >> 8, ten = code & 0xFF;
+
+    if (ku == 0)
+        return strchr(")]},.!?:;%", ten) != NULL && ten != 0;
+    if (ku == 1)
+        return inSet(noStartRow1, sizeof(noStartRow1), ten);
+    if (ku == 4 || ku == 5)
+        return inSet(smallKana, sizeof(smallKana), ten);
+    return false;
+}
+
+static bool noEnd(unsigned short code)
+{
+    int ku = code >> 8, ten = code & 0xFF;
+
+    if (ku == 0)
+        return strchr("([{", ten) != NULL && ten != 0;
+    return ku == 1 && inSet(noEndRow1, sizeof(noEndRow1), ten);
+}
+
+// A line may break between prev and next
+static bool canBreak(unsigned short prev, unsigned short next)
+{
+    if (isSpace(next) || noStart(next) || noEnd(prev))
+        return false;
+    return !(isWord(prev) && isWord(next));
+}
+
+static uint32_t hashOf(const char *str, int maxWidth)
+{
+    uint32_t hash = 2166136261u ^ (uint32_t)maxWidth;
+
+    for (; *str; str++)
+    {
+        hash = (hash ^ (unsigned char)*str) * 16777619u;
+    }
+    return hash;
+}
+
+TextLayout::TextLayout(GlyphCache &glyphs) : _glyphs(glyphs)
+{
+    memset(&counters, 0, sizeof(counters));
+    clear();
+}
+
+int TextLayout::charWidth(unsigned short code)
+{
+    int width;
+
+    if (code == CODE_NEWLINE)
+        return 0;
+    GT20L16J1Y_FONT::kuten_address(code, &width);
+    return width;
+}
+
+int TextLayout::measure(const char *str)
+{
+    unsigned short code;
+    int width = 0;
+
+    while (*str && *str != '\n')
+    {
+        str = utf8NextKuten(str, &code);
+        width += charWidth(code);
+    }
+    return width;
+}
+
+// Close the line [first, end) of layout; false if there is no room for it
+static bool endLine(Layout *layout, int first, int end)
+{
+    LayoutLine *line;
+    int i;
+
+    if (layout->lineCount == LAYOUT_MAX_LINES)
+        return false;
+    line = &layout->lines[layout->lineCount++];
+    line->first = first;
+    line->count = end - first;
+    line->width = 0;
+    // trailing spaces hang past the margin
+    while (end > first && (isSpace(layout->codes[end - 1]) || layout->codes[end - 1] == CODE_NEWLINE))
+    {
+        end--;
+    }
+    for (i = first; i < end; i++)
+    {
+        line->width += TextLayout::charWidth(layout->codes[i]);
+    }
+    if (line->width > layout->width)
+        layout->width = line->width;
+    return true;
+}
+
+// Decode str into layout->codes and break it into lines at layout->maxWidth;
+// false if it was cut at LAYOUT_MAX_CHARS or LAYOUT_MAX_LINES
+bool TextLayout::breakLines(Layout *layout, const char *str)
+{
+    unsigned short *codes = layout->codes;
+    int i, b, first, width, w;
+
+    layout->length = 0;
+    layout->lineCount = 0;
+    layout->width = 0;
+    while (*str && layout->length < LAYOUT_MAX_CHARS)
+    {
+        if (*str == '\n')
+        {
+            codes[layout->length++] = CODE_NEWLINE;
+            str++;
+        }
+        else
+        {
+            str = utf8NextKuten(str, &codes[layout->length++]);
+        }
+    }
+
+    first = 0;
+    width = 0;
+    for (i = 0; i < layout->length; i++)
+    {
+        if (codes[i] == CODE_NEWLINE)
+        {
+            if (!endLine(layout, first, i + 1))
+                return false;
+            first = i + 1;
+            width = 0;
+            continue;
+        }
+        w = charWidth(codes[i]);
+        if (layout->maxWidth > 0 && width + w > layout->maxWidth && !isSpace(codes[i]) && i > first)
+        {
+            // last legal break at or before i; none: break at i anyway
+            for (b = i; b > first && !canBreak(codes[b - 1], codes[b]); b--)
+            {
+            }
+            if (b == first)
+                b = i;
+            if (!endLine(layout, first, b))
+                return false;
+            first = b;
+            for (width = 0; b < i; b++)
+            {
+                width += charWidth(codes[b]);
+            }
+        }
+        width += w;
+    }
+    if (first < layout->length && !endLine(layout, first, layout->length))
+        return false;
+    return *str == 0;
+}
+
+const Layout *TextLayout::layout(const char *str, int maxWidth)
+{
+    Entry *entry, *victim;
+    uint32_t hash;
+    int i;
+
+    if (strlen(str) >= LAYOUT_MAX_BYTES)
+    {
+        counters.layouts++;
+        counters.uncached++;
+        _scratch.maxWidth = maxWidth;
+        _scratch.truncated = !breakLines(&_scratch, str);
+        return &_scratch;
+    }
+
+    hash = hashOf(str, maxWidth);
+    victim = &_entries[0];
+    for (i = 0; i < LAYOUT_CACHE_SIZE; i++)
+    {
+        entry = &_entries[i];
+        if (entry->used != 0 && entry->hash == hash && entry->layout.maxWidth == maxWidth &&
+            strcmp(entry->text, str) == 0)
+        {
+            counters.hits++;
+            entry->used = ++_stamp;
+            return &entry->layout;
+        }
+        if (entry->used < victim->used)
+            victim = entry;
+    }
+
+    counters.layouts++;
+    victim->hash = hash;
+    victim->used = ++_stamp;
+    strcpy(victim->text, str);
+    victim->layout.maxWidth = maxWidth;
+    victim->layout.truncated = !breakLines(&victim->layout, str);
+    return &victim->layout;
+}
+
+void TextLayout::draw(Surface &surface, int x, int y, const Layout *layout, RasterOp op)
+{
+    const LayoutLine *line;
+    const unsigned char *cg;
+    unsigned short codes[LAYOUT_MAX_CHARS];
+    unsigned char bitmap[32];
+    unsigned short code;
+    int i, j, n, r, cx, width;
+
+    // fetch the missing glyphs in address-sorted bursts
+    for (i = 0, n = 0; i < layout->length; i++)
+    {
+        if (layout->codes[i] != CODE_NEWLINE && !isSpace(layout->codes[i]))
+            codes[n++] = layout->codes[i];
+    }
+    _glyphs.prefetch(codes, n);
+
+    for (i = 0; i < layout->lineCount; i++, y += LAYOUT_LINE_HEIGHT)
+    {
+        if (y >= surface.height() || y + LAYOUT_LINE_HEIGHT <= 0)
+            continue;
+        line = &layout->lines[i];
+        cx = x;
+        for (j = line->first; j < line->first + line->count; j++)
+        {
+            code = layout->codes[j];
+            if (code == CODE_NEWLINE)
+                continue;
+            if (isSpace(code))
+            {
+                cx += charWidth(code);
+                continue;
+            }
+            // CGRAM cells (UL, UR, LL, LR) to 16 lines of 2 bytes
+            cg = _glyphs.kuten(code, &width);
+            for (r = 0; r < 8; r++)
+            {
+                bitmap[r * 2] = cg[r];
+                bitmap[r * 2 + 1] = cg[8 + r];
+                bitmap[16 + r * 2] = cg[16 + r];
+                bitmap[17 + r * 2] = cg[24 + r];
+            }
+            surface.blit(cx, y, bitmap, width, 16, 2, op);
+            counters.glyphs++;
+            cx += width;
+        }
+    }
+}
+
+const Layout *TextLayout::draw(Surface &surface, int x, int y, const char *str, int maxWidth, RasterOp op)
+{
+    const Layout *result = layout(str, maxWidth);
+
+    draw(surface, x, y, result, op);
+    return result;
+}
+
+void TextLayout::clear()
+{
+    int i;
+
+    for (i = 0; i < LAYOUT_CACHE_SIZE; i++)
+    {
+        _entries[i].used = 0;
+    }
+    _stamp = 0;
+}
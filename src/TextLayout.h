@@ -0,0 +1,125 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include <stdint.h>
+#include "GlyphCache.h"
+#include "Surface.h"
+
+#ifndef LAYOUT_MAX_CHARS
+#define LAYOUT_MAX_CHARS 64 // characters of a laid out string
+#endif
+#ifndef LAYOUT_MAX_LINES
+#define LAYOUT_MAX_LINES 8 // lines of a laid out string
+#endif
+#ifndef LAYOUT_MAX_BYTES
+#define LAYOUT_MAX_BYTES 128 // UTF-8 bytes of a cached string, including the terminator
+#endif
+#ifndef LAYOUT_CACHE_SIZE
+#define LAYOUT_CACHE_SIZE 8 // cached layouts (-D LAYOUT_CACHE_SIZE=n to override)
+#endif
+#define LAYOUT_LINE_HEIGHT 16 // pixels per line
+
+/** Counters of a TextLayout */
+struct TextLayoutCounters {
+    unsigned long layouts;  // strings laid out
+    unsigned long hits;     // layouts served from the cache
+    unsigned long glyphs;   // glyphs drawn
+    unsigned long uncached; // strings longer than LAYOUT_MAX_BYTES (laid out every time)
+};
+
+/** One line of a Layout: characters [first, first + count) */
+struct LayoutLine {
+    unsigned char first;
+    unsigned char count;
+    short width; // pixels, trailing spaces excluded
+};
+
+/** A string broken into lines */
+struct Layout {
+    unsigned short codes[LAYOUT_MAX_CHARS]; // Kuten codes
+    LayoutLine lines[LAYOUT_MAX_LINES];
+    int length;    // characters
+    int lineCount;
+    int width;     // widest line in pixels
+    int maxWidth;  // wrap width it was laid out for
+    bool truncated; // cut at LAYOUT_MAX_CHARS or LAYOUT_MAX_LINES
+};
+
+/** Mixed-width text in the graphics plane
+ *
+ *  Half-width (8 pixel) and full-width (16 pixel) glyphs are placed at any
+ *  pixel position through Surface::blit(), which shifts and merges them
+ *  across byte boundaries, so labels are not bound to the 8 pixel text
+ *  grid or to 2-cell kanji.
+ *
+ *  Lines wrap at maxWidth with the usual Japanese line breaking (kinsoku)
+ *  rules: closing brackets, 、。 and small kana never start a line, opening
+ *  brackets never end one, ASCII words are only broken at spaces, and
+ *  spaces at a break hang past the margin. A character that would start a
+ *  line illegally pulls the preceding one onto the next line with it.
+ *
+ *  Layouts are kept in an LRU cache of LAYOUT_CACHE_SIZE entries keyed by
+ *  the string contents and width, so a label drawn every frame is decoded
+ *  and broken once.
+ */
+class TextLayout {
+  public:
+    /** Create a layout engine
+     *
+     *  @param glyphs Glyph source for drawing
+     */
+    TextLayout(GlyphCache &glyphs);
+    virtual ~TextLayout() {};
+
+    /** Width of a Kuten code in pixels (8 or 16) */
+    static int charWidth(unsigned short code);
+
+    /** Width of a UTF-8 string on one line, in pixels ('\n' ends the measure) */
+    static int measure(const char *str);
+
+    /** Break a UTF-8 string into lines, or get the cached result
+     *
+     *  @param str UTF-8 string, '\n' forces a line break
+     *  @param maxWidth Wrap width in pixels (0 = no wrapping)
+     *  @return layout, valid until the next call (cached ones until evicted)
+     */
+    const Layout *layout(const char *str, int maxWidth = 0);
+
+    /** Draw a layout with its top left corner at (x, y)
+     *
+     *  @param surface Surface to draw on
+     *  @param x Left edge in pixels
+     *  @param y Top edge in pixels
+     *  @param layout Layout to draw
+     *  @param op Raster operation
+     */
+    void draw(Surface &surface, int x, int y, const Layout *layout, RasterOp op = ROP_OR);
+
+    /** Lay out and draw a UTF-8 string
+     *
+     *  @return layout, e.g. for its size
+     */
+    const Layout *draw(Surface &surface, int x, int y, const char *str, int maxWidth = 0, RasterOp op = ROP_OR);
+
+    /** Drop every cached layout */
+    void clear();
+
+    TextLayoutCounters counters;
+
+  private:
+    struct Entry {
+        Layout layout;
+        uint32_t hash;
+        unsigned long used; // LRU stamp, 0 = empty
+        char text[LAYOUT_MAX_BYTES];
+    };
+
+    static bool breakLines(Layout *layout, const char *str);
+
+    GlyphCache &_glyphs;
+    Entry _entries[LAYOUT_CACHE_SIZE];
+    Layout _scratch; // strings too long to cache
+    unsigned long _stamp;
+};
+
+#endif
@@ -0,0 +1,1380 @@
+// Generated by kutentable.py -- do not edit
+#include "Utf8Kuten.h"
+
+// 7053 code points, 358 blocks
+const unsigned short unicodeKutenTop[1024] = {
+    0xffff, 0xffff, 0x0000, 0x0001, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0002, 0x0003,
+    0x0004, 0x0005, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0006, 0xffff, 0xffff, 0xffff, 0x0007, 0x0008, 0x0009, 0x000a,
+    0x000b, 0x000c, 0x000d, 0xffff, 0x000e, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x000f, 0xffff, 0xffff, 0x0010, 0x0011, 0x0012, 0x0013,
+    0x0014, 0x0015, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0016, 0x0017, 0x0018, 0x0019, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x001a, 0xffff, 0x001b, 0xffff, 0x001c, 0x001d, 0x001e, 0x001f,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+    0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+    0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+    0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+    0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+    0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+    0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+    0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+    0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+    0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+    0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+    0x00e0, 0x00e1, 0x00e2, 0xffff, 0x00e3, 0x00e4, 0x00e5, 0x00e6,
+    0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee,
+    0x00ef, 0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6,
+    0x00f7, 0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe,
+    0x00ff, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106,
+    0x0107, 0x0108, 0x0109, 0x010a, 0x010b, 0x010c, 0x010d, 0x010e,
+    0x010f, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0xffff,
+    0x0116, 0x0117, 0x0118, 0x0119, 0x011a, 0x011b, 0x011c, 0x011d,
+    0x011e, 0x011f, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125,
+    0x0126, 0x0127, 0x0128, 0x0129, 0x012a, 0x012b, 0x012c, 0x012d,
+    0x012e, 0x012f, 0x0130, 0x0131, 0x0132, 0x0133, 0x0134, 0x0135,
+    0x0136, 0x0137, 0x0138, 0xffff, 0xffff, 0x0139, 0x013a, 0x013b,
+    0x013c, 0x013d, 0x013e, 0x013f, 0x0140, 0x0141, 0x0142, 0x0143,
+    0x0144, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149, 0x014a, 0x014b,
+    0x014c, 0x014d, 0x014e, 0x014f, 0x0150, 0x0151, 0x0152, 0x0153,
+    0x0154, 0x0155, 0xffff, 0x0156, 0x0157, 0x0158, 0x0159, 0x015a,
+    0x015b, 0x015c, 0x015d, 0x015e, 0x015f, 0x0160, 0x0161, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0162, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0163, 0x0164, 0xffff, 0x0165,
+};
+
+const UnicodeKutenBlock unicodeKutenBlocks[358] = {
+    {0x00000000UL, 0x0053118cUL, 0},
+    {0x00800000UL, 0x00800000UL, 9},
+    {0xfffe0000UL, 0xfffe03fbUL, 11},
+    {0x000003fbUL, 0x00000000UL, 50},
+    {0xffff0002UL, 0xffffffffUL, 59},
+    {0x0002ffffUL, 0x00000000UL, 108},
+    {0x33610000UL, 0x080d0063UL, 125},
+    {0x00400008UL, 0x00000802UL, 140},
+    {0x00000000UL, 0x000003ffUL, 144},
+    {0x000f0000UL, 0x00000000UL, 154},
+    {0x00140000UL, 0x00000000UL, 158},
+    {0xe406098dUL, 0x20305fa1UL, 160},
+    {0x00040000UL, 0x00000cc3UL, 184},
+    {0x000000ccUL, 0x80000020UL, 191},
+    {0x00040000UL, 0x00000000UL, 197},
+    {0x00000000UL, 0x000fffffUL, 198},
+    {0x3999900fUL, 0x99999939UL, 218},
+    {0x00000804UL, 0x00000000UL, 248},
+    {0x00000000UL, 0x300c0003UL, 250},
+    {0x0000c8c0UL, 0x00008000UL, 256},
+    {0x00000060UL, 0x00000000UL, 262},
+    {0x00000005UL, 0x0000a400UL, 264},
+    {0xb03fffefUL, 0x00000000UL, 269},
+    {0xfffffffeUL, 0xffffffffUL, 293},
+    {0x780fffffUL, 0xfffffffeUL, 356},
+    {0xffffffffUL, 0x787fffffUL, 411},
+    {0x00000000UL, 0x02060000UL, 470},
+    {0x00000000UL, 0x000001f0UL, 473},
+    {0x01102008UL, 0x084008ccUL, 478},
+    {0x00822600UL, 0x78000000UL, 489},
+    {0x7000c000UL, 0x00000002UL, 498},
+    {0x00002010UL, 0x00000000UL, 504},
+    {0x43f36f8bUL, 0x9b462542UL, 506},
+    {0xe3e0e82cUL, 0x400a0004UL, 538},
+    {0xdb365f65UL, 0x04497977UL, 557},
+    {0xe3f0ecd7UL, 0x18c5603aUL, 592},
+    {0x3403e60bUL, 0x37518000UL, 624},
+    {0x7eebe0c8UL, 0x98698200UL, 646},
+    {0x2d56ad48UL, 0x8060e803UL, 673},
+    {0xad93661cUL, 0xc568c03aUL, 697},
+    {0xc656aa60UL, 0x02403f7eUL, 726},
+    {0x146183cdUL, 0x21751020UL, 754},
+    {0x07122021UL, 0x40bc3000UL, 776},
+    {0x4562a624UL, 0x0a3060a8UL, 792},
+    {0x85740217UL, 0x9c840402UL, 813},
+    {0x14157ffbUL, 0x11e27f34UL, 833},
+    {0x22efb665UL, 0x60ff1f75UL, 868},
+    {0x38403a70UL, 0x676336c3UL, 906},
+    {0x20b24dd9UL, 0x0fc946b0UL, 934},
+    {0x4850bc98UL, 0xa03f8638UL, 962},
+    {0x98162388UL, 0x52323e49UL, 988},
+    {0xeba422abUL, 0xc72c00ddUL, 1013},
+    {0x26e1a1e7UL, 0x8f0a841bUL, 1043},
+    {0x559e27ebUL, 0x89bfc241UL, 1072},
+    {0x85480014UL, 0x084d6361UL, 1106},
+    {0xaad07f0cUL, 0x05cfff3eUL, 1125},
+    {0xa803ff1aUL, 0x7b407a41UL, 1162},
+    {0x80024745UL, 0x38eb0500UL, 1192},
+    {0x1005dc51UL, 0x710c9b34UL, 1212},
+    {0x01000397UL, 0xa4046366UL, 1237},
+    {0x005180d0UL, 0x430ac000UL, 1257},
+    {0x30c89071UL, 0x58000008UL, 1271},
+    {0xf7000ed9UL, 0x00415f80UL, 1286},
+    {0x941000b0UL, 0x62800018UL, 1310},
+    {0x09d00240UL, 0x01568200UL, 1323},
+    {0x08015004UL, 0x05101d10UL, 1337},
+    {0x001084c1UL, 0x10504025UL, 1350},
+    {0x4d8a410fUL, 0xa60d4009UL, 1363},
+    {0x914cab19UL, 0x098121c0UL, 1386},
+    {0x0203c485UL, 0x80000672UL, 1408},
+    {0x00080b04UL, 0x0009141dUL, 1424},
+    {0x905c49c9UL, 0x16900009UL, 1437},
+    {0x22200c65UL, 0x24338412UL, 1457},
+    {0x47960c03UL, 0x42250a04UL, 1476},
+    {0xd0880028UL, 0x4f0c4900UL, 1496},
+    {0xd3aa14a2UL, 0x3e87d830UL, 1513},
+    {0x1f618e04UL, 0x41867ea4UL, 1542},
+    {0x2dbbc390UL, 0x211857adUL, 1569},
+    {0x2a48241eUL, 0x4e041138UL, 1599},
+    {0x161b0a40UL, 0x88400d60UL, 1620},
+    {0x9502020aUL, 0x10608221UL, 1638},
+    {0x04000243UL, 0x80001444UL, 1653},
+    {0x0c040000UL, 0x70000000UL, 1663},
+    {0x00c11a06UL, 0x0c00024aUL, 1669},
+    {0x00401a00UL, 0x40451404UL, 1683},
+    {0xbdf30029UL, 0x052b0a78UL, 1694},
+    {0xbfa0bba9UL, 0x8379407cUL, 1721},
+    {0xe91d12fdUL, 0xc5695bf6UL, 1754},
+    {0x444aeff6UL, 0xff022115UL, 1791},
+    {0x402bed63UL, 0x0242d033UL, 1823},
+    {0x00131000UL, 0x5dca1b42UL, 1848},
+    {0x020000a0UL, 0x2c61a703UL, 1867},
+    {0x8ff24880UL, 0x00000284UL, 1883},
+    {0x100d5804UL, 0x0048b200UL, 1899},
+    {0x20011894UL, 0x37805004UL, 1913},
+    {0x684d3200UL, 0x68be49eaUL, 1929},
+    {0x2e42184cUL, 0x21c9a820UL, 1956},
+    {0x80b050b9UL, 0xff7c001eUL, 1977},
+    {0x14e0849aUL, 0x01e028c1UL, 2005},
+    {0xac49870eUL, 0xdddb130fUL, 2025},
+    {0x89fbbe1aUL, 0x51b2a2e2UL, 2058},
+    {0x32ca5522UL, 0x928b3ec6UL, 2091},
+    {0x438f1dbfUL, 0x32986703UL, 2120},
+    {0x33c03028UL, 0xa9230811UL, 2152},
+    {0x3a65c000UL, 0x04028fe3UL, 2172},
+    {0x86252c4eUL, 0x00a1bf3dUL, 2194},
+    {0x8cd43a1aUL, 0x317c06c9UL, 2222},
+    {0x950a00e0UL, 0x0edb018bUL, 2250},
+    {0x8c20e34bUL, 0xf0101182UL, 2273},
+    {0xa7287d94UL, 0x40fbc9acUL, 2295},
+    {0x06534484UL, 0x44445a90UL, 2327},
+    {0x00013fc8UL, 0xf5d40048UL, 2347},
+    {0xec577701UL, 0x891dc442UL, 2369},
+    {0x49286b83UL, 0xd2424109UL, 2398},
+    {0x59fe061dUL, 0x3a221800UL, 2421},
+    {0x3b9fb7e4UL, 0xc0eaf003UL, 2446},
+    {0x82021386UL, 0xe4008980UL, 2480},
+    {0x10a1b200UL, 0x0cc44b80UL, 2497},
+    {0x8944d309UL, 0x48341fafUL, 2515},
+    {0x0c458259UL, 0x0450420aUL, 2543},
+    {0x10c8a040UL, 0x44503140UL, 2561},
+    {0x01004004UL, 0x05408280UL, 2576},
+    {0x442c0108UL, 0x1a056a30UL, 2585},
+    {0x051420a6UL, 0x645690cfUL, 2603},
+    {0x31000021UL, 0xcbf09c18UL, 2627},
+    {0x63e2a120UL, 0x01b5104cUL, 2647},
+    {0x9a83538cUL, 0x3281b8b2UL, 2669},
+    {0x0a84987aUL, 0x0c0233e7UL, 2696},
+    {0x9018d4ccUL, 0x9072a1a1UL, 2721},
+    {0xe0048a1eUL, 0x0451c3d4UL, 2745},
+    {0x21c2439aUL, 0x53104844UL, 2768},
+    {0x36400292UL, 0xfbbd0241UL, 2789},
+    {0xe8f0ab09UL, 0xa5d27dc0UL, 2814},
+    {0xd24bc242UL, 0xd0afa43fUL, 2845},
+    {0x34a11aa0UL, 0x03d88247UL, 2876},
+    {0x651bc452UL, 0xc83ad294UL, 2899},
+    {0x40c8001cUL, 0x33140e06UL, 2927},
+    {0xb21b614fUL, 0xc0d00088UL, 2945},
+    {0xa898a02aUL, 0x166ba1c5UL, 2968},
+    {0x85b42f50UL, 0x0604c08bUL, 2994},
+    {0x1e04f933UL, 0xa251056eUL, 3017},
+    {0x76380400UL, 0x73b8ec07UL, 3045},
+    {0x18324406UL, 0xc8164081UL, 3071},
+    {0x63097c8aUL, 0xaa042980UL, 3089},
+    {0xca9c1c24UL, 0x27604e0eUL, 3112},
+    {0x83000990UL, 0x81040046UL, 3138},
+    {0x10816011UL, 0x0908540dUL, 3151},
+    {0xcc0a000eUL, 0x0c000500UL, 3167},
+    {0xa0440430UL, 0x6784008bUL, 3180},
+    {0x8a195288UL, 0x8b18865eUL, 3198},
+    {0x41602e59UL, 0x9cbe8c10UL, 3223},
+    {0x891c6861UL, 0x00089800UL, 3249},
+    {0x089a8100UL, 0x41900018UL, 3265},
+    {0xe4a14007UL, 0x640d0505UL, 3278},
+    {0x0e4d310eUL, 0xff0a4806UL, 3299},
+    {0x2aa81632UL, 0x000b852eUL, 3326},
+    {0xca841800UL, 0x696c0e20UL, 3348},
+    {0x16000032UL, 0x03905658UL, 3368},
+    {0x1a285120UL, 0x11248000UL, 3385},
+    {0x432618e1UL, 0x0eaa5d52UL, 3399},
+    {0xae280fa0UL, 0x4500fa7bUL, 3426},
+    {0x89406408UL, 0xc044c880UL, 3454},
+    {0xb1419005UL, 0x24c48424UL, 3470},
+    {0x603a1a34UL, 0xc1949000UL, 3489},
+    {0x003a8246UL, 0xc106180dUL, 3509},
+    {0x99100022UL, 0x1511e050UL, 3528},
+    {0x00824057UL, 0x020a041aUL, 3545},
+    {0x8930004fUL, 0x444ad813UL, 3560},
+    {0xed228a02UL, 0x400510c0UL, 3582},
+    {0x01021000UL, 0x31018808UL, 3600},
+    {0x02044600UL, 0x0f08f000UL, 3610},
+    {0xa2008900UL, 0x22020000UL, 3624},
+    {0x16100200UL, 0x10400042UL, 3633},
+    {0x02605200UL, 0x200052f4UL, 3642},
+    {0x82308510UL, 0x42021100UL, 3657},
+    {0x80b54308UL, 0x9a2070e1UL, 3670},
+    {0x08012040UL, 0xfc653500UL, 3692},
+    {0xab0419c1UL, 0x62140286UL, 3710},
+    {0x00440087UL, 0x02449085UL, 3731},
+    {0x0a85405cUL, 0x33803207UL, 3745},
+    {0xb8c00400UL, 0xc0d0ce20UL, 3766},
+    {0x0080c030UL, 0x0d250508UL, 3784},
+    {0x00400a90UL, 0x080c0200UL, 3798},
+    {0x40006505UL, 0x41026421UL, 3807},
+    {0x00000268UL, 0x847c0024UL, 3822},
+    {0xde200002UL, 0x40498619UL, 3835},
+    {0x40000808UL, 0x20010084UL, 3853},
+    {0x10108400UL, 0x01c742cdUL, 3860},
+    {0xd52a7038UL, 0x1d8f9968UL, 3877},
+    {0x3e12be50UL, 0x81d92ef5UL, 3907},
+    {0x2412cec4UL, 0x732e0828UL, 3939},
+    {0x4b3424acUL, 0xd41d020cUL, 3963},
+    {0x80002a02UL, 0x08110097UL, 3987},
+    {0x114411c4UL, 0x7d451786UL, 4000},
+    {0x064949d9UL, 0x87914000UL, 4025},
+    {0xd8c4254cUL, 0x491444baUL, 4046},
+    {0xc8001b92UL, 0x15800271UL, 4071},
+    {0x0c000081UL, 0xc200096aUL, 4090},
+    {0x40024800UL, 0xba493021UL, 4103},
+    {0x1c802080UL, 0x1008e2acUL, 4119},
+    {0x00341004UL, 0x841400e1UL, 4135},
+    {0x20000020UL, 0x10149800UL, 4148},
+    {0x04aa70c2UL, 0x54208688UL, 4156},
+    {0x04130c62UL, 0x20109180UL, 4176},
+    {0x02064082UL, 0x54001c40UL, 4191},
+    {0xe4e90383UL, 0x84802125UL, 4204},
+    {0x2000e433UL, 0xe60944c0UL, 4226},
+    {0x81260a03UL, 0x080112daUL, 4246},
+    {0x97906901UL, 0xf8864001UL, 4264},
+    {0x0081e24dUL, 0xa6510a0eUL, 4286},
+    {0x81ec011aUL, 0x8441c600UL, 4308},
+    {0xb62cadb8UL, 0x8741a46fUL, 4327},
+    {0x4b028d54UL, 0x02681161UL, 4359},
+    {0x2057bb60UL, 0x043350a0UL, 4380},
+    {0xb7b4a8c0UL, 0x01122402UL, 4403},
+    {0x20009ad3UL, 0x00c82271UL, 4424},
+    {0x809e2081UL, 0xe1800c8aUL, 4443},
+    {0x8151b009UL, 0x40281031UL, 4462},
+    {0x89a52a0eUL, 0x620e69b6UL, 4479},
+    {0xd1444425UL, 0x4d548085UL, 4507},
+    {0x1fb12c75UL, 0x862dd807UL, 4529},
+    {0x4841d87cUL, 0x226e414eUL, 4560},
+    {0x9e088200UL, 0xed37f80cUL, 4586},
+    {0x75268c80UL, 0x08149313UL, 4612},
+    {0xc8040e32UL, 0x6ea6484eUL, 4634},
+    {0x66702c4aUL, 0xba0126c0UL, 4659},
+    {0x185dd70cUL, 0x00000000UL, 4683},
+    {0x00000000UL, 0x05400000UL, 4698},
+    {0x81337020UL, 0x03a54f81UL, 4701},
+    {0x641055ecUL, 0x2344c318UL, 4724},
+    {0x00341462UL, 0x1a090a43UL, 4748},
+    {0x13a5187bUL, 0xa8480102UL, 4766},
+    {0xc5440440UL, 0xe2dd8106UL, 4788},
+    {0x2d481af0UL, 0x0416b626UL, 4810},
+    {0x6e405058UL, 0x31128032UL, 4835},
+    {0x0c0007e4UL, 0x420a8208UL, 4855},
+    {0x803b4840UL, 0x87134860UL, 4871},
+    {0x3428850dUL, 0xe5290319UL, 4891},
+    {0x870a2345UL, 0x5c1825a9UL, 4915},
+    {0xd9c577a6UL, 0x03e85e00UL, 4940},
+    {0xa7000081UL, 0x41c6cd54UL, 4970},
+    {0xa2042800UL, 0x2b0ab860UL, 4991},
+    {0xda9e0020UL, 0x0e1a08eaUL, 5009},
+    {0x11c0427cUL, 0x03768908UL, 5032},
+    {0x01058621UL, 0x18a80000UL, 5054},
+    {0xc44846a0UL, 0x20220d05UL, 5067},
+    {0x91485422UL, 0x28978a01UL, 5085},
+    {0x00087898UL, 0x31221605UL, 5106},
+    {0x08804240UL, 0x06a2fa4eUL, 5124},
+    {0x92110814UL, 0x9b042002UL, 5144},
+    {0x16432e52UL, 0x90105000UL, 5160},
+    {0x85ba0041UL, 0x20203042UL, 5178},
+    {0x05a04f0bUL, 0x40802708UL, 5194},
+    {0x1a930591UL, 0x0600df50UL, 5213},
+    {0x3021a202UL, 0x4e800630UL, 5236},
+    {0x04c80cc4UL, 0x8001a004UL, 5253},
+    {0xd4316000UL, 0x0a020880UL, 5267},
+    {0x00281c00UL, 0x00418e18UL, 5281},
+    {0xca106ad0UL, 0x4b00f210UL, 5294},
+    {0x1506274dUL, 0x88900220UL, 5316},
+    {0x82a85a00UL, 0x81504549UL, 5335},
+    {0x80002004UL, 0x2c088804UL, 5354},
+    {0x000508d1UL, 0x4ac48001UL, 5364},
+    {0x0062e020UL, 0x0a42008eUL, 5379},
+    {0x6a8c3055UL, 0xe0a5090eUL, 5394},
+    {0x42c42906UL, 0x80b34814UL, 5419},
+    {0xb330803eUL, 0x731c0102UL, 5439},
+    {0x700d1494UL, 0x09400c20UL, 5462},
+    {0xc040301aUL, 0xc094a451UL, 5479},
+    {0x05c88dcaUL, 0xa40c96c2UL, 5498},
+    {0x34040001UL, 0x011000c8UL, 5523},
+    {0xa9c9550dUL, 0x1c5a2428UL, 5533},
+    {0x48370142UL, 0x100f7a4dUL, 5559},
+    {0x452a32b4UL, 0x9205317bUL, 5583},
+    {0x5c44b894UL, 0x458a68d7UL, 5610},
+    {0x2ed15097UL, 0x42081943UL, 5638},
+    {0x9d40d202UL, 0x20979840UL, 5662},
+    {0x064d5409UL, 0x00000000UL, 5683},
+    {0x00000000UL, 0x84800000UL, 5694},
+    {0x04215542UL, 0x17001c06UL, 5697},
+    {0x61107624UL, 0xb9ddff87UL, 5715},
+    {0x5c0a659fUL, 0x3c00245dUL, 5749},
+    {0x0059adb0UL, 0x00000000UL, 5776},
+    {0x00000000UL, 0x009b28d0UL, 5788},
+    {0x02000422UL, 0x44080108UL, 5798},
+    {0xac409804UL, 0x90288d0aUL, 5807},
+    {0xe0018700UL, 0x00310400UL, 5826},
+    {0x82211794UL, 0x10540019UL, 5838},
+    {0x021a2cb2UL, 0x40039c02UL, 5856},
+    {0x88043d60UL, 0x7900080cUL, 5875},
+    {0xba3c1628UL, 0xcb088640UL, 5893},
+    {0x90807274UL, 0x0000001eUL, 5917},
+    {0xd8000000UL, 0x9c87e188UL, 5932},
+    {0x04124034UL, 0x2791ae64UL, 5950},
+    {0xe6fbe86bUL, 0x5366408fUL, 5972},
+    {0x537feea6UL, 0xb5e4e32bUL, 6007},
+    {0x0002869fUL, 0x01228548UL, 6046},
+    {0x08004402UL, 0x20a02116UL, 6064},
+    {0x02040004UL, 0x00052000UL, 6076},
+    {0x01547e00UL, 0x01ac162cUL, 6082},
+    {0x10852a84UL, 0x05308c14UL, 6103},
+    {0xb943fbc3UL, 0x906000caUL, 6121},
+    {0x40326000UL, 0x80901200UL, 6148},
+    {0x4c810b30UL, 0x40020054UL, 6159},
+    {0x1d6a0129UL, 0x02802000UL, 6174},
+    {0x00048000UL, 0x170c2610UL, 6189},
+    {0x07018040UL, 0x0c24d94dUL, 6201},
+    {0x18502910UL, 0x50205001UL, 6220},
+    {0x04d01000UL, 0x02017080UL, 6234},
+    {0x21c30108UL, 0x00000132UL, 6245},
+    {0x07190088UL, 0x05600802UL, 6257},
+    {0x4c0e0012UL, 0xf0a10405UL, 6271},
+    {0x00000002UL, 0x00000000UL, 6289},
+    {0x00000000UL, 0x00800000UL, 6290},
+    {0x035a8e8dUL, 0x5a0421bdUL, 6291},
+    {0x11703488UL, 0x00000026UL, 6318},
+    {0x10000000UL, 0x8804c502UL, 6331},
+    {0xf801b815UL, 0x25ed147cUL, 6340},
+    {0x1bb0ed60UL, 0x1bd70589UL, 6369},
+    {0x1a627af3UL, 0x0ac50d0cUL, 6399},
+    {0x524ae5d1UL, 0x63050490UL, 6427},
+    {0x52440354UL, 0x16122b57UL, 6451},
+    {0x1101a872UL, 0x00182949UL, 6475},
+    {0x10080948UL, 0x886c6000UL, 6493},
+    {0x058f916eUL, 0x39903012UL, 6507},
+    {0x4930f840UL, 0x001b8880UL, 6532},
+    {0x00000000UL, 0x00428500UL, 6550},
+    {0x98000058UL, 0x7014ea04UL, 6555},
+    {0x611d1628UL, 0x60005113UL, 6572},
+    {0x00a71a24UL, 0x00000000UL, 6592},
+    {0x03c00000UL, 0x10187120UL, 6602},
+    {0xa9270172UL, 0x89066004UL, 6614},
+    {0x020cc022UL, 0x40810900UL, 6635},
+    {0x8ca0202dUL, 0x00000e34UL, 6647},
+    {0x00000000UL, 0x11012100UL, 6663},
+    {0xc11a8011UL, 0x0892ec4cUL, 6668},
+    {0x85000040UL, 0x1806c7acUL, 6689},
+    {0x0512e03eUL, 0x00108000UL, 6706},
+    {0x80ce4008UL, 0x02106d01UL, 6720},
+    {0x08568641UL, 0x0027011eUL, 6736},
+    {0x083d3750UL, 0x4e05e032UL, 6755},
+    {0x048401c0UL, 0x01400081UL, 6780},
+    {0x00000000UL, 0x00591aa0UL, 6790},
+    {0x882443c8UL, 0xc8001d48UL, 6799},
+    {0x72030152UL, 0x04049013UL, 6818},
+    {0x04008280UL, 0x0d148a10UL, 6835},
+    {0x02088056UL, 0x2704a040UL, 6848},
+    {0x4c000000UL, 0x00000000UL, 6863},
+    {0x00000000UL, 0xa3200000UL, 6866},
+    {0xa0ae1902UL, 0xdf002660UL, 6871},
+    {0x7b15f010UL, 0x3ad08121UL, 6894},
+    {0x00284180UL, 0x48001003UL, 6919},
+    {0x8014cc00UL, 0x00c414cfUL, 6929},
+    {0x30202000UL, 0x00000001UL, 6947},
+    {0x0003c000UL, 0x00000000UL, 6952},
+    {0xffffff7aUL, 0xffffffffUL, 6956},
+    {0x7fffffffUL, 0x00000000UL, 7017},
+    {0x00000000UL, 0x0000002fUL, 7048},
+};
+
+const unsigned short unicodeKutenCodes[7053] = {
+    0x0151, 0x0152, 0x0158, 0x010f, 0x022c, 0x014b, 0x013e, 0x010d,
+    0x0259, 0x013f, 0x0140, 0x0601, 0x0602, 0x0603, 0x0604, 0x0605,
+    0x0606, 0x0607, 0x0608, 0x0609, 0x060a, 0x060b, 0x060c, 0x060d,
+    0x060e, 0x060f, 0x0610, 0x0611, 0x0612, 0x0613, 0x0614, 0x0615,
+    0x0616, 0x0617, 0x0618, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625,
+    0x0626, 0x0627, 0x0628, 0x0629, 0x062a, 0x062b, 0x062c, 0x062d,
+    0x062e, 0x062f, 0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635,
+    0x0636, 0x0637, 0x0638, 0x0707, 0x0701, 0x0702, 0x0703, 0x0704,
+    0x0705, 0x0706, 0x0708, 0x0709, 0x070a, 0x070b, 0x070c, 0x070d,
+    0x070e, 0x070f, 0x0710, 0x0711, 0x0712, 0x0713, 0x0714, 0x0715,
+    0x0716, 0x0717, 0x0718, 0x0719, 0x071a, 0x071b, 0x071c, 0x071d,
+    0x071e, 0x071f, 0x0720, 0x0721, 0x0731, 0x0732, 0x0733, 0x0734,
+    0x0735, 0x0736, 0x0738, 0x0739, 0x073a, 0x073b, 0x073c, 0x073d,
+    0x073e, 0x073f, 0x0740, 0x0741, 0x0742, 0x0743, 0x0744, 0x0745,
+    0x0746, 0x0747, 0x0748, 0x0749, 0x074a, 0x074b, 0x074c, 0x074d,
+    0x074e, 0x074f, 0x0750, 0x0751, 0x0737, 0x011e, 0x011d, 0x0122,
+    0x0126, 0x0127, 0x0128, 0x0129, 0x0257, 0x0258, 0x0125, 0x0124,
+    0x0253, 0x014c, 0x014d, 0x0208, 0x014e, 0x0d42, 0x0d44, 0x0252,
+    0x0d15, 0x0d16, 0x0d17, 0x0d18, 0x0d19, 0x0d1a, 0x0d1b, 0x0d1c,
+    0x0d1d, 0x0d1e, 0x020b, 0x020c, 0x020a, 0x020d, 0x022d, 0x022e,
+    0x022f, 0x023f, 0x0230, 0x0240, 0x021a, 0x021b, 0x0d54, 0x013d,
+    0x0245, 0x0247, 0x0147, 0x0d58, 0x023c, 0x0122, 0x022a, 0x022b,
+    0x0221, 0x0220, 0x0249, 0x024a, 0x0d53, 0x0148, 0x0248, 0x0246,
+    0x0242, 0x0142, 0x0241, 0x0145, 0x0146, 0x0243, 0x0244, 0x021e,
+    0x021f, 0x021c, 0x021d, 0x023d, 0x0d59, 0x023e, 0x0d01, 0x0d02,
+    0x0d03, 0x0d04, 0x0d05, 0x0d06, 0x0d07, 0x0d08, 0x0d09, 0x0d0a,
+    0x0d0b, 0x0d0c, 0x0d0d, 0x0d0e, 0x0d0f, 0x0d10, 0x0d11, 0x0d12,
+    0x0d13, 0x0d14, 0x0801, 0x080c, 0x0802, 0x080d, 0x0803, 0x080e,
+    0x0804, 0x080f, 0x0806, 0x0811, 0x0805, 0x0810, 0x0807, 0x081c,
+    0x0817, 0x0812, 0x0809, 0x081e, 0x0819, 0x0814, 0x0808, 0x0818,
+    0x081d, 0x0813, 0x080a, 0x081a, 0x081f, 0x0815, 0x080b, 0x081b,
+    0x0820, 0x0816, 0x0203, 0x0202, 0x0205, 0x0204, 0x0207, 0x0206,
+    0x0201, 0x015e, 0x015b, 0x015d, 0x015c, 0x025e, 0x015a, 0x0159,
+    0x014a, 0x0149, 0x0256, 0x0255, 0x0254, 0x0101, 0x0102, 0x0103,
+    0x0117, 0x0119, 0x011a, 0x011b, 0x0132, 0x0133, 0x0134, 0x0135,
+    0x0136, 0x0137, 0x0138, 0x0139, 0x013a, 0x013b, 0x0209, 0x020e,
+    0x012c, 0x012d, 0x0121, 0x0d40, 0x0d41, 0x0401, 0x0402, 0x0403,
+    0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040a, 0x040b,
+    0x040c, 0x040d, 0x040e, 0x040f, 0x0410, 0x0411, 0x0412, 0x0413,
+    0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041a, 0x041b,
+    0x041c, 0x041d, 0x041e, 0x041f, 0x0420, 0x0421, 0x0422, 0x0423,
+    0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042a, 0x042b,
+    0x042c, 0x042d, 0x042e, 0x042f, 0x0430, 0x0431, 0x0432, 0x0433,
+    0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043a, 0x043b,
+    0x043c, 0x043d, 0x043e, 0x043f, 0x0440, 0x0441, 0x0442, 0x0443,
+    0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044a, 0x044b,
+    0x044c, 0x044d, 0x044e, 0x044f, 0x0450, 0x0451, 0x0452, 0x0453,
+    0x010b, 0x010c, 0x0115, 0x0116, 0x0501, 0x0502, 0x0503, 0x0504,
+    0x0505, 0x0506, 0x0507, 0x0508, 0x0509, 0x050a, 0x050b, 0x050c,
+    0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0512, 0x0513, 0x0514,
+    0x0515, 0x0516, 0x0517, 0x0518, 0x0519, 0x051a, 0x051b, 0x051c,
+    0x051d, 0x051e, 0x051f, 0x0520, 0x0521, 0x0522, 0x0523, 0x0524,
+    0x0525, 0x0526, 0x0527, 0x0528, 0x0529, 0x052a, 0x052b, 0x052c,
+    0x052d, 0x052e, 0x052f, 0x0530, 0x0531, 0x0532, 0x0533, 0x0534,
+    0x0535, 0x0536, 0x0537, 0x0538, 0x0539, 0x053a, 0x053b, 0x053c,
+    0x053d, 0x053e, 0x053f, 0x0540, 0x0541, 0x0542, 0x0543, 0x0544,
+    0x0545, 0x0546, 0x0547, 0x0548, 0x0549, 0x054a, 0x054b, 0x054c,
+    0x054d, 0x054e, 0x054f, 0x0550, 0x0551, 0x0552, 0x0553, 0x0554,
+    0x0555, 0x0556, 0x0106, 0x011c, 0x0113, 0x0114, 0x0d4a, 0x0d4b,
+    0x0d4c, 0x0d45, 0x0d46, 0x0d47, 0x0d48, 0x0d49, 0x0d26, 0x0d2a,
+    0x0d21, 0x0d24, 0x0d22, 0x0d2c, 0x0d2b, 0x0d25, 0x0d2d, 0x0d27,
+    0x0d2f, 0x0d20, 0x0d2e, 0x0d23, 0x0d28, 0x0d29, 0x0d3f, 0x0d4f,
+    0x0d4e, 0x0d4d, 0x0d33, 0x0d34, 0x0d30, 0x0d31, 0x0d32, 0x0d36,
+    0x0d35, 0x0d43, 0x104c, 0x235a, 0x1c17, 0x2b5c, 0x1e46, 0x1b10,
+    0x1e45, 0x121c, 0x2934, 0x2d1f, 0x3002, 0x110f, 0x134e, 0x3003,
+    0x2004, 0x3222, 0x1536, 0x2a1a, 0x1e47, 0x2e1e, 0x2a22, 0x590d,
+    0x3004, 0x2346, 0x3005, 0x165a, 0x3006, 0x143d, 0x2310, 0x1c47,
+    0x3007, 0x3008, 0x3009, 0x2715, 0x1537, 0x2717, 0x2643, 0x1823,
+    0x2b13, 0x4929, 0x300a, 0x1e48, 0x300b, 0x1215, 0x1645, 0x1850,
+    0x2c49, 0x3606, 0x2d50, 0x265d, 0x1405, 0x1515, 0x300c, 0x300d,
+    0x2e1b, 0x2d1d, 0x2148, 0x300f, 0x1b56, 0x2653, 0x3012, 0x111e,
+    0x183f, 0x183e, 0x1046, 0x2f2b, 0x2f2a, 0x1a13, 0x1001, 0x3013,
+    0x3014, 0x3015, 0x2b14, 0x3016, 0x1852, 0x1047, 0x2b52, 0x155c,
+    0x155d, 0x155e, 0x2442, 0x2e1c, 0x3017, 0x3018, 0x3019, 0x1f2d,
+    0x1d1a, 0x1f2e, 0x301e, 0x301c, 0x301d, 0x1538, 0x1a03, 0x1250,
+    0x301b, 0x301a, 0x2a09, 0x1b26, 0x1b25, 0x221e, 0x301f, 0x2935,
+    0x2047, 0x0118, 0x3020, 0x3022, 0x590e, 0x2245, 0x2e41, 0x102a,
+    0x3021, 0x121e, 0x1624, 0x2347, 0x174f, 0x3023, 0x2704, 0x590f,
+    0x5910, 0x144b, 0x5911, 0x3024, 0x102b, 0x1840, 0x144c, 0x295a,
+    0x2812, 0x1539, 0x1251, 0x3047, 0x2521, 0x274c, 0x3026, 0x281c,
+    0x2e42, 0x1f0d, 0x5912, 0x1b27, 0x1b57, 0x1220, 0x2431, 0x2302,
+    0x302a, 0x102c, 0x2443, 0x1d1b, 0x1a14, 0x2d04, 0x222e, 0x121f,
+    0x5913, 0x3029, 0x2d1e, 0x3025, 0x3027, 0x1a4e, 0x3028, 0x3504,
+    0x3030, 0x3033, 0x3031, 0x1222, 0x2a1b, 0x302b, 0x302f, 0x1853,
+    0x1b28, 0x1406, 0x3034, 0x302c, 0x5915, 0x2e43, 0x1b58, 0x302d,
+    0x3032, 0x5914, 0x5917, 0x3035, 0x302e, 0x5916, 0x1601, 0x102d,
+    0x1602, 0x1221, 0x3505, 0x2b59, 0x294e, 0x1854, 0x1f0f, 0x2e17,
+    0x2a38, 0x1718, 0x2205, 0x1244, 0x5906, 0x1d33, 0x5918, 0x3039,
+    0x303e, 0x303c, 0x3037, 0x220f, 0x303a, 0x303d, 0x303b, 0x2a3d,
+    0x3038, 0x1f0e, 0x2b53, 0x303f, 0x3040, 0x1d04, 0x304d, 0x2730,
+    0x2916, 0x3048, 0x2a50, 0x1216, 0x304c, 0x591b, 0x3046, 0x304f,
+    0x2132, 0x1824, 0x273c, 0x4027, 0x304e, 0x253d, 0x3043, 0x1856,
+    0x1855, 0x3041, 0x591c, 0x1c3a, 0x3049, 0x591a, 0x2a4f, 0x232d,
+    0x3045, 0x1751, 0x3042, 0x304a, 0x3044, 0x2e31, 0x304b, 0x2f21,
+    0x1646, 0x1750, 0x5919, 0x591f, 0x3050, 0x591d, 0x3051, 0x3055,
+    0x102e, 0x2a30, 0x3054, 0x3053, 0x3057, 0x3056, 0x2444, 0x1752,
+    0x3058, 0x591e, 0x1c25, 0x2206, 0x2445, 0x1656, 0x3059, 0x1516,
+    0x305a, 0x305c, 0x2b15, 0x1746, 0x5920, 0x1b11, 0x2857, 0x305b,
+    0x1a25, 0x2d23, 0x305e, 0x3103, 0x305d, 0x1a24, 0x1d5d, 0x1719,
+    0x3104, 0x162f, 0x3101, 0x3102, 0x260f, 0x215c, 0x1603, 0x2b2d,
+    0x3105, 0x5922, 0x2e1d, 0x3106, 0x3109, 0x3107, 0x212e, 0x3108,
+    0x310a, 0x5921, 0x310c, 0x310b, 0x2a28, 0x1517, 0x310e, 0x310f,
+    0x120f, 0x310d, 0x1c54, 0x3112, 0x3111, 0x3110, 0x3036, 0x3113,
+    0x1d5e, 0x3114, 0x2d05, 0x2c39, 0x3116, 0x3115, 0x3118, 0x3117,
+    0x3119, 0x311a, 0x1054, 0x1815, 0x171b, 0x1d1c, 0x235b, 0x1604,
+    0x2048, 0x1857, 0x5923, 0x194e, 0x311c, 0x2c28, 0x2526, 0x1b59,
+    0x311b, 0x311d, 0x253e, 0x1355, 0x311e, 0x5924, 0x265e, 0x2114,
+    0x3120, 0x3121, 0x280c, 0x1858, 0x2f1b, 0x3122, 0x1606, 0x2a1c,
+    0x2216, 0x1651, 0x2515, 0x1753, 0x3123, 0x3124, 0x2642, 0x113f,
+    0x3127, 0x1a5d, 0x3126, 0x1a26, 0x3128, 0x464e, 0x3129, 0x2b21,
+    0x312a, 0x312b, 0x312c, 0x1e49, 0x1c2c, 0x5925, 0x1407, 0x312f,
+    0x312d, 0x2c1d, 0x312e, 0x293a, 0x3130, 0x3131, 0x3132, 0x253f,
+    0x3136, 0x3134, 0x3135, 0x3133, 0x1a43, 0x3137, 0x2c4a, 0x2e44,
+    0x3138, 0x5926, 0x2008, 0x3139, 0x1d3a, 0x313a, 0x235c, 0x2e1f,
+    0x2540, 0x3225, 0x313b, 0x5405, 0x1625, 0x313c, 0x2b3e, 0x1d48,
+    0x225c, 0x313e, 0x2644, 0x5927, 0x313f, 0x3140, 0x130e, 0x3141,
+    0x1607, 0x262c, 0x115a, 0x1d30, 0x2801, 0x3142, 0x2541, 0x1f2f,
+    0x3143, 0x2a0c, 0x203a, 0x1402, 0x1409, 0x3144, 0x3146, 0x171a,
+    0x3145, 0x5928, 0x2e53, 0x1d49, 0x281d, 0x2a2c, 0x3147, 0x2d58,
+    0x3148, 0x3149, 0x255e, 0x314a, 0x2009, 0x1a5e, 0x1754, 0x314b,
+    0x1b29, 0x194f, 0x2446, 0x314d, 0x2207, 0x1a4f, 0x314e, 0x314f,
+    0x2110, 0x314c, 0x3151, 0x2b16, 0x1944, 0x3150, 0x1755, 0x1a3e,
+    0x274d, 0x3154, 0x3152, 0x295b, 0x1e4a, 0x315b, 0x1344, 0x3155,
+    0x3153, 0x212f, 0x3157, 0x3156, 0x1324, 0x1740, 0x315c, 0x2e0d,
+    0x3158, 0x315d, 0x315a, 0x3159, 0x2e2f, 0x5929, 0x1859, 0x1223,
+    0x2e54, 0x592a, 0x1d55, 0x2538, 0x1945, 0x3202, 0x3203, 0x2e45,
+    0x2f0b, 0x3205, 0x185a, 0x3204, 0x130f, 0x592b, 0x3206, 0x2b36,
+    0x241c, 0x2d06, 0x2a39, 0x3207, 0x5035, 0x2610, 0x3208, 0x140a,
+    0x2c13, 0x592c, 0x1e01, 0x3209, 0x2a47, 0x320d, 0x200a, 0x320a,
+    0x1630, 0x320b, 0x140b, 0x170e, 0x320e, 0x320f, 0x3210, 0x3211,
+    0x1c3b, 0x185b, 0x2c3e, 0x592d, 0x2c48, 0x2657, 0x2a51, 0x3212,
+    0x592e, 0x3213, 0x3215, 0x3217, 0x3216, 0x3218, 0x121d, 0x2b2c,
+    0x1a5c, 0x3219, 0x2139, 0x1e02, 0x1609, 0x321a, 0x592f, 0x283b,
+    0x321b, 0x321c, 0x321d, 0x321e, 0x2904, 0x1648, 0x1045, 0x261f,
+    0x321f, 0x1d1d, 0x2049, 0x3221, 0x3220, 0x1e03, 0x1841, 0x3223,
+    0x281e, 0x3224, 0x283c, 0x2214, 0x224e, 0x1608, 0x264e, 0x2311,
+    0x274e, 0x2b2e, 0x3226, 0x204a, 0x1715, 0x3227, 0x3228, 0x110c,
+    0x1055, 0x144d, 0x5930, 0x2208, 0x1531, 0x2d51, 0x322b, 0x1217,
+    0x322a, 0x160a, 0x322c, 0x2c51, 0x5931, 0x322d, 0x2e32, 0x185c,
+    0x1816, 0x322e, 0x3230, 0x322f, 0x1f3f, 0x1119, 0x113e, 0x3231,
+    0x3232, 0x5932, 0x1817, 0x3233, 0x154e, 0x1b12, 0x3234, 0x2b54,
+    0x1a15, 0x153a, 0x2d07, 0x2130, 0x281f, 0x1c5d, 0x1d27, 0x1c48,
+    0x1c55, 0x1d56, 0x2820, 0x5933, 0x3237, 0x1123, 0x2131, 0x185d,
+    0x1825, 0x1647, 0x323b, 0x2301, 0x225e, 0x160b, 0x1e04, 0x323c,
+    0x323a, 0x1224, 0x2246, 0x1c18, 0x1b2b, 0x1106, 0x1350, 0x1946,
+    0x1b2a, 0x323d, 0x323e, 0x1529, 0x1326, 0x1947, 0x1528, 0x243f,
+    0x1105, 0x2611, 0x2c1e, 0x1901, 0x2d59, 0x2527, 0x185e, 0x170f,
+    0x3247, 0x1643, 0x2b2a, 0x283d, 0x3246, 0x143e, 0x3241, 0x3242,
+    0x3244, 0x3245, 0x153b, 0x1f41, 0x2a0d, 0x3243, 0x323f, 0x1843,
+    0x3240, 0x2f04, 0x2a52, 0x2448, 0x1842, 0x1950, 0x3248, 0x263d,
+    0x324c, 0x1c5e, 0x1c56, 0x324f, 0x324d, 0x2c03, 0x324a, 0x3253,
+    0x324e, 0x3251, 0x1826, 0x2c1f, 0x3252, 0x3254, 0x3256, 0x5936,
+    0x1a50, 0x2f22, 0x324b, 0x3249, 0x3255, 0x3250, 0x5935, 0x3258,
+    0x3303, 0x325a, 0x325e, 0x5937, 0x3301, 0x325b, 0x331e, 0x1a49,
+    0x1311, 0x3259, 0x3305, 0x1056, 0x3304, 0x1005, 0x292a, 0x3302,
+    0x325c, 0x3257, 0x325d, 0x1a28, 0x3306, 0x1057, 0x330f, 0x3307,
+    0x3308, 0x1e05, 0x2b49, 0x330d, 0x330c, 0x250f, 0x330e, 0x330b,
+    0x5938, 0x1114, 0x1a16, 0x1f10, 0x3309, 0x2542, 0x330a, 0x1002,
+    0x3314, 0x2d03, 0x1e07, 0x331a, 0x3319, 0x3310, 0x2223, 0x3311,
+    0x224f, 0x3316, 0x1e06, 0x3313, 0x2c44, 0x171c, 0x3317, 0x3318,
+    0x3315, 0x331b, 0x3312, 0x3321, 0x3326, 0x3322, 0x331d, 0x3327,
+    0x2111, 0x5939, 0x3329, 0x1902, 0x331f, 0x235d, 0x3323, 0x331c,
+    0x140d, 0x144e, 0x1345, 0x3324, 0x3320, 0x1756, 0x332a, 0x3328,
+    0x2133, 0x152a, 0x160c, 0x3325, 0x1654, 0x1124, 0x332e, 0x332c,
+    0x3407, 0x3331, 0x332b, 0x332f, 0x332d, 0x1b2c, 0x3330, 0x3333,
+    0x3338, 0x3336, 0x3335, 0x2312, 0x1225, 0x3332, 0x3334, 0x1e08,
+    0x1113, 0x3337, 0x123e, 0x3342, 0x1e5c, 0x333e, 0x333c, 0x333d,
+    0x333f, 0x111d, 0x2119, 0x3339, 0x333a, 0x135a, 0x3341, 0x144f,
+    0x3344, 0x3340, 0x3343, 0x2a0e, 0x2635, 0x2818, 0x3346, 0x3345,
+    0x1325, 0x3347, 0x334a, 0x3349, 0x3348, 0x2719, 0x334b, 0x334c,
+    0x334e, 0x334d, 0x3350, 0x3353, 0x3351, 0x334f, 0x3352, 0x3354,
+    0x3355, 0x3356, 0x3357, 0x3358, 0x3125, 0x1c5c, 0x1b2d, 0x1253,
+    0x1058, 0x2324, 0x3359, 0x1a04, 0x102f, 0x1f3e, 0x335a, 0x1827,
+    0x1951, 0x335c, 0x335b, 0x2a40, 0x335d, 0x3401, 0x335e, 0x3402,
+    0x3403, 0x1757, 0x1140, 0x3404, 0x3406, 0x3405, 0x3408, 0x253a,
+    0x3409, 0x1015, 0x1a3f, 0x171d, 0x232f, 0x340a, 0x340b, 0x340d,
+    0x340e, 0x1a44, 0x1631, 0x2b17, 0x340c, 0x340f, 0x1a21, 0x1903,
+    0x593a, 0x3413, 0x1a05, 0x593b, 0x2313, 0x3410, 0x243a, 0x3414,
+    0x1f42, 0x3412, 0x3415, 0x171f, 0x3416, 0x3417, 0x1904, 0x1320,
+    0x3419, 0x341a, 0x593c, 0x341b, 0x3418, 0x3411, 0x341c, 0x341d,
+    0x593e, 0x593d, 0x2b44, 0x1e4b, 0x341f, 0x3420, 0x341e, 0x3422,
+    0x2718, 0x1048, 0x2936, 0x3423, 0x1e5d, 0x1c19, 0x273d, 0x1450,
+    0x1a4b, 0x2b39, 0x2612, 0x1758, 0x222f, 0x3421, 0x3424, 0x2224,
+    0x3425, 0x3426, 0x3428, 0x2449, 0x140e, 0x5401, 0x1141, 0x2a53,
+    0x1e4c, 0x2528, 0x1a46, 0x342e, 0x2a1d, 0x2e3d, 0x1254, 0x342a,
+    0x211a, 0x342d, 0x2543, 0x2529, 0x2544, 0x2819, 0x242d, 0x1a29,
+    0x3429, 0x1156, 0x2516, 0x342b, 0x3427, 0x1f30, 0x342f, 0x1d2e,
+    0x160d, 0x3430, 0x2a48, 0x215d, 0x2426, 0x5941, 0x3432, 0x2b2f,
+    0x3433, 0x3438, 0x5942, 0x2a0f, 0x3437, 0x3431, 0x3434, 0x3436,
+    0x1a06, 0x2a29, 0x3439, 0x2325, 0x1255, 0x1e4d, 0x343b, 0x343a,
+    0x1948, 0x343c, 0x343e, 0x343d, 0x3440, 0x3435, 0x3442, 0x3441,
+    0x343f, 0x1b2e, 0x1f31, 0x2134, 0x3443, 0x201c, 0x104d, 0x2744,
+    0x243b, 0x3445, 0x3444, 0x3446, 0x3447, 0x3448, 0x3449, 0x2a31,
+    0x344a, 0x5943, 0x1226, 0x344b, 0x2d1c, 0x1310, 0x3229, 0x1d28,
+    0x221f, 0x344c, 0x2c4b, 0x2c14, 0x344e, 0x2247, 0x2517, 0x2220,
+    0x2937, 0x344f, 0x3450, 0x115b, 0x1c1a, 0x3451, 0x1030, 0x3452,
+    0x3453, 0x1142, 0x1451, 0x2640, 0x2a54, 0x3457, 0x2135, 0x3456,
+    0x1720, 0x5944, 0x2b3b, 0x3455, 0x2545, 0x3459, 0x3458, 0x5945,
+    0x5946, 0x345b, 0x345a, 0x5947, 0x115c, 0x345c, 0x1e09, 0x345e,
+    0x2305, 0x345d, 0x2a13, 0x1d57, 0x253b, 0x3501, 0x1905, 0x3502,
+    0x2701, 0x283e, 0x2c31, 0x2705, 0x350b, 0x1518, 0x2d25, 0x2c0f,
+    0x360c, 0x3503, 0x3506, 0x5948, 0x2225, 0x2b18, 0x252a, 0x3507,
+    0x2b45, 0x5949, 0x1a2a, 0x1e0a, 0x3508, 0x1b30, 0x1b2f, 0x1019,
+    0x1828, 0x200b, 0x1031, 0x350c, 0x350d, 0x350a, 0x1118, 0x140f,
+    0x3509, 0x2c25, 0x2911, 0x1008, 0x1059, 0x1b31, 0x1032, 0x1003,
+    0x3512, 0x3510, 0x2c1c, 0x3513, 0x3511, 0x350f, 0x1f11, 0x350e,
+    0x2a3a, 0x1844, 0x3517, 0x3518, 0x1e0b, 0x3514, 0x2f0c, 0x272c,
+    0x3516, 0x1a07, 0x3519, 0x2938, 0x351a, 0x3515, 0x2c1b, 0x273e,
+    0x351b, 0x2912, 0x351c, 0x3520, 0x351d, 0x1227, 0x351f, 0x1c1b,
+    0x351e, 0x1759, 0x352c, 0x3525, 0x3522, 0x2344, 0x3521, 0x3523,
+    0x3524, 0x3526, 0x3527, 0x1452, 0x3529, 0x3528, 0x352a, 0x1e4e,
+    0x352d, 0x243c, 0x1125, 0x352b, 0x352e, 0x352f, 0x3532, 0x3530,
+    0x3531, 0x1b32, 0x3533, 0x1906, 0x3534, 0x594a, 0x1b5a, 0x2218,
+    0x3535, 0x3536, 0x1b3a, 0x1907, 0x2c32, 0x1508, 0x1829, 0x3537,
+    0x1338, 0x3538, 0x2219, 0x3539, 0x3603, 0x353a, 0x353b, 0x353c,
+    0x353e, 0x353f, 0x3540, 0x2250, 0x1107, 0x1c49, 0x1022, 0x2137,
+    0x1410, 0x1c15, 0x1908, 0x2546, 0x1d01, 0x1411, 0x2348, 0x244a,
+    0x1018, 0x1519, 0x2a55, 0x1c22, 0x1532, 0x204b, 0x1c1c, 0x2d08,
+    0x3541, 0x153c, 0x1a2b, 0x1312, 0x1143, 0x1e0c, 0x1228, 0x3542,
+    0x2d26, 0x1d29, 0x594b, 0x1c44, 0x3543, 0x1453, 0x2632, 0x2c09,
+    0x3544, 0x3545, 0x2939, 0x3547, 0x1408, 0x1657, 0x3546, 0x594d,
+    0x1412, 0x1f12, 0x354b, 0x1b01, 0x1229, 0x354a, 0x3548, 0x354c,
+    0x3549, 0x270b, 0x3c2d, 0x1f13, 0x354d, 0x594e, 0x2e20, 0x354e,
+    0x3550, 0x235e, 0x354f, 0x2003, 0x1b5b, 0x2230, 0x1c57, 0x2955,
+    0x204c, 0x1c2d, 0x3551, 0x1e0d, 0x3552, 0x3553, 0x1033, 0x221a,
+    0x1f32, 0x3554, 0x2613, 0x1e0e, 0x1e0f, 0x3555, 0x204d, 0x1e10,
+    0x594f, 0x3556, 0x3557, 0x2c40, 0x3558, 0x1626, 0x1d02, 0x3559,
+    0x355a, 0x1c3c, 0x1f0c, 0x2654, 0x1f34, 0x2858, 0x2702, 0x1629,
+    0x355b, 0x154f, 0x355c, 0x165e, 0x262f, 0x1210, 0x1b33, 0x355d,
+    0x3602, 0x3601, 0x165d, 0x355e, 0x2518, 0x2210, 0x252b, 0x1c28,
+    0x2138, 0x2d5a, 0x3604, 0x3605, 0x2636, 0x1b13, 0x3607, 0x3608,
+    0x3609, 0x1454, 0x360a, 0x360b, 0x120c, 0x5950, 0x211b, 0x1444,
+    0x360d, 0x2c08, 0x2232, 0x1339, 0x360f, 0x3611, 0x143f, 0x5951,
+    0x360e, 0x3610, 0x3613, 0x3612, 0x3614, 0x3615, 0x261d, 0x160e,
+    0x1245, 0x3616, 0x361b, 0x3619, 0x2a57, 0x2a56, 0x5952, 0x2547,
+    0x3618, 0x1d34, 0x3617, 0x1f52, 0x361c, 0x1a4a, 0x3622, 0x3623,
+    0x361d, 0x1313, 0x361e, 0x3627, 0x3626, 0x3625, 0x3621, 0x3620,
+    0x3624, 0x5953, 0x2a58, 0x5956, 0x362b, 0x3628, 0x362a, 0x2d52,
+    0x3629, 0x5954, 0x361f, 0x1f53, 0x362c, 0x5957, 0x1a17, 0x362d,
+    0x362e, 0x3631, 0x3630, 0x362f, 0x2548, 0x361a, 0x3637, 0x3633,
+    0x3632, 0x3634, 0x3635, 0x3638, 0x5958, 0x5959, 0x2e46, 0x3639,
+    0x3636, 0x363a, 0x1440, 0x363b, 0x595a, 0x363d, 0x363c, 0x363e,
+    0x363f, 0x204e, 0x1d03, 0x1d44, 0x2143, 0x1909, 0x1a18, 0x190a,
+    0x1550, 0x3640, 0x1a19, 0x182a, 0x3641, 0x2c06, 0x2723, 0x3642,
+    0x190b, 0x140c, 0x2307, 0x1632, 0x1b34, 0x293b, 0x2821, 0x3643,
+    0x1455, 0x3646, 0x2401, 0x3645, 0x3644, 0x3647, 0x244b, 0x1f43,
+    0x1b35, 0x202a, 0x2233, 0x1502, 0x2402, 0x3648, 0x3649, 0x1e4f,
+    0x2b19, 0x364c, 0x364b, 0x364a, 0x295d, 0x3653, 0x2b3a, 0x364d,
+    0x364f, 0x2b4b, 0x364e, 0x3650, 0x2808, 0x3651, 0x2a1e, 0x3652,
+    0x1413, 0x2a1f, 0x270f, 0x3654, 0x3655, 0x190c, 0x1414, 0x3656,
+    0x1818, 0x2d24, 0x2d09, 0x1456, 0x3658, 0x2403, 0x190d, 0x1e11,
+    0x283f, 0x1e12, 0x1d58, 0x244c, 0x2a59, 0x2519, 0x190e, 0x293c,
+    0x3659, 0x2539, 0x1a22, 0x182b, 0x244d, 0x1023, 0x1d4e, 0x190f,
+    0x2d27, 0x365a, 0x365b, 0x2731, 0x365c, 0x2e57, 0x2f0d, 0x365e,
+    0x365d, 0x1327, 0x3701, 0x3704, 0x3705, 0x3703, 0x2920, 0x1e13,
+    0x3707, 0x3706, 0x3702, 0x3708, 0x3709, 0x370a, 0x370d, 0x370b,
+    0x370c, 0x370e, 0x1144, 0x244e, 0x370f, 0x175a, 0x1256, 0x2716,
+    0x3710, 0x265b, 0x2a3b, 0x3711, 0x2f0e, 0x3712, 0x2a20, 0x3715,
+    0x3001, 0x3011, 0x1c10, 0x2655, 0x3716, 0x153d, 0x2404, 0x105a,
+    0x3717, 0x2a06, 0x1910, 0x2330, 0x244f, 0x595b, 0x2c4f, 0x1819,
+    0x182c, 0x3718, 0x3719, 0x371f, 0x1c45, 0x595c, 0x2405, 0x160f,
+    0x371a, 0x290b, 0x2326, 0x371b, 0x590c, 0x371c, 0x1610, 0x371d,
+    0x371e, 0x3720, 0x2556, 0x3721, 0x3722, 0x3723, 0x3714, 0x3713,
+    0x3724, 0x1721, 0x2907, 0x595d, 0x1a2c, 0x2917, 0x2406, 0x292b,
+    0x3725, 0x1e14, 0x1126, 0x3726, 0x3727, 0x2c52, 0x2840, 0x372a,
+    0x115d, 0x200c, 0x3729, 0x3728, 0x1722, 0x2234, 0x372e, 0x372c,
+    0x372b, 0x2e07, 0x1845, 0x1d59, 0x372d, 0x252c, 0x1d1e, 0x2620,
+    0x3731, 0x3730, 0x372f, 0x3732, 0x1846, 0x3733, 0x295c, 0x1d3b,
+    0x3734, 0x2859, 0x2621, 0x2407, 0x595e, 0x2510, 0x3735, 0x150b,
+    0x1f14, 0x290c, 0x1457, 0x2706, 0x3736, 0x1b36, 0x2b1a, 0x2b1b,
+    0x115e, 0x373b, 0x2349, 0x3738, 0x1257, 0x380d, 0x373a, 0x2710,
+    0x3739, 0x3737, 0x195a, 0x373d, 0x3743, 0x3749, 0x3741, 0x253c,
+    0x3746, 0x293d, 0x3740, 0x3745, 0x2e47, 0x1b37, 0x2235, 0x373e,
+    0x153e, 0x3748, 0x200d, 0x1145, 0x3742, 0x1258, 0x3747, 0x1611,
+    0x3744, 0x374a, 0x374c, 0x3756, 0x3754, 0x3751, 0x3750, 0x2e58,
+    0x3752, 0x1612, 0x1911, 0x1d5a, 0x3759, 0x374b, 0x374f, 0x373f,
+    0x125a, 0x3753, 0x3755, 0x2331, 0x1a08, 0x1218, 0x374d, 0x3758,
+    0x3757, 0x1613, 0x2209, 0x1346, 0x1723, 0x374e, 0x375a, 0x375d,
+    0x3801, 0x1c1d, 0x3807, 0x2450, 0x375b, 0x3805, 0x1259, 0x3803,
+    0x3804, 0x375e, 0x3802, 0x1847, 0x2d0a, 0x1415, 0x1139, 0x3806,
+    0x271a, 0x100d, 0x2841, 0x373c, 0x380c, 0x3810, 0x2c45, 0x3809,
+    0x2549, 0x380e, 0x1e50, 0x380f, 0x2637, 0x2f27, 0x380b, 0x3811,
+    0x195b, 0x202b, 0x1034, 0x380a, 0x3808, 0x213a, 0x375c, 0x1b14,
+    0x2226, 0x381d, 0x213b, 0x3818, 0x3815, 0x3816, 0x1c46, 0x3819,
+    0x381c, 0x3817, 0x1d05, 0x381a, 0x3814, 0x2c5c, 0x2c5b, 0x381e,
+    0x381f, 0x1035, 0x3813, 0x1652, 0x1006, 0x1416, 0x381b, 0x3823,
+    0x3822, 0x3827, 0x3828, 0x3826, 0x3829, 0x3821, 0x3825, 0x382a,
+    0x382b, 0x3820, 0x1b5c, 0x3824, 0x2236, 0x1912, 0x3812, 0x1f15,
+    0x3838, 0x2a49, 0x382e, 0x382f, 0x3830, 0x3837, 0x3836, 0x2b5d,
+    0x1417, 0x3834, 0x1725, 0x1314, 0x3831, 0x2e18, 0x3833, 0x1036,
+    0x3835, 0x382c, 0x3832, 0x3839, 0x1724, 0x382d, 0x2d3d, 0x2d0b,
+    0x383c, 0x3840, 0x215e, 0x2e59, 0x3841, 0x383e, 0x383b, 0x383a,
+    0x383f, 0x2a10, 0x2614, 0x1726, 0x3842, 0x383d, 0x3843, 0x175b,
+    0x1211, 0x384b, 0x1418, 0x3849, 0x384a, 0x1a09, 0x3848, 0x3846,
+    0x3845, 0x384c, 0x3844, 0x384e, 0x125b, 0x3850, 0x384f, 0x2408,
+    0x3853, 0x3851, 0x3847, 0x175c, 0x3852, 0x3856, 0x3855, 0x3857,
+    0x3854, 0x3858, 0x3859, 0x385a, 0x2a4a, 0x385c, 0x385b, 0x1d1f,
+    0x200e, 0x1246, 0x125c, 0x385d, 0x101f, 0x202c, 0x385e, 0x4c23,
+    0x3901, 0x1741, 0x3902, 0x204f, 0x3903, 0x3904, 0x151a, 0x3905,
+    0x3906, 0x3907, 0x2237, 0x182d, 0x2c41, 0x2b1c, 0x1d4a, 0x3908,
+    0x2050, 0x4e1d, 0x2842, 0x1c4a, 0x1a2d, 0x3909, 0x2227, 0x2a07,
+    0x2251, 0x390c, 0x390a, 0x390d, 0x390b, 0x390e, 0x2a11, 0x1017,
+    0x293e, 0x2843, 0x390f, 0x3912, 0x1e15, 0x151b, 0x3910, 0x3917,
+    0x1e16, 0x3911, 0x2724, 0x2d3e, 0x3913, 0x3914, 0x3918, 0x254a,
+    0x3915, 0x1913, 0x203e, 0x3926, 0x2814, 0x2252, 0x2844, 0x3a0d,
+    0x2a5a, 0x2451, 0x2b55, 0x391b, 0x1201, 0x234a, 0x3924, 0x2314,
+    0x391e, 0x3925, 0x3920, 0x3927, 0x3923, 0x3922, 0x274f, 0x391c,
+    0x125d, 0x391a, 0x1551, 0x2253, 0x3916, 0x3919, 0x1914, 0x203b,
+    0x1e17, 0x3921, 0x2732, 0x1552, 0x1328, 0x1347, 0x1f01, 0x3929,
+    0x392e, 0x392a, 0x175d, 0x392f, 0x1b02, 0x1949, 0x1d06, 0x391d,
+    0x1b5d, 0x392c, 0x1b38, 0x392d, 0x1024, 0x3928, 0x2409, 0x1553,
+    0x1614, 0x392b, 0x1007, 0x1a23, 0x1f16, 0x2452, 0x2834, 0x3931,
+    0x213e, 0x220a, 0x1b0b, 0x3932, 0x3934, 0x3930, 0x2a41, 0x241d,
+    0x213c, 0x2a5b, 0x1c2e, 0x3940, 0x393f, 0x1f58, 0x175e, 0x3939,
+    0x1e19, 0x2648, 0x2711, 0x3937, 0x213d, 0x1c58, 0x393c, 0x1e18,
+    0x3936, 0x393b, 0x2733, 0x3935, 0x1701, 0x133d, 0x393d, 0x2e0b,
+    0x1a2e, 0x2315, 0x393a, 0x203c, 0x1915, 0x1f44, 0x1146, 0x211c,
+    0x3938, 0x1525, 0x1727, 0x242f, 0x393e, 0x213f, 0x3941, 0x3943,
+    0x2217, 0x3949, 0x3944, 0x3946, 0x2921, 0x2453, 0x3947, 0x2d0c,
+    0x2d28, 0x1419, 0x100e, 0x3945, 0x3942, 0x1458, 0x1147, 0x3948,
+    0x2d29, 0x394c, 0x221b, 0x3953, 0x394d, 0x394a, 0x3951, 0x3933,
+    0x394e, 0x3952, 0x2822, 0x254b, 0x394b, 0x394f, 0x1728, 0x1a51,
+    0x203d, 0x3957, 0x2506, 0x3954, 0x2b40, 0x3955, 0x3956, 0x2c2e,
+    0x2002, 0x1742, 0x395d, 0x1b15, 0x395a, 0x3959, 0x2712, 0x2615,
+    0x2511, 0x395b, 0x395c, 0x294f, 0x2725, 0x1b03, 0x2051, 0x2b30,
+    0x1329, 0x3a05, 0x395e, 0x2d2a, 0x3a07, 0x3a03, 0x3a04, 0x2140,
+    0x3a02, 0x391f, 0x3a06, 0x3a01, 0x3a0b, 0x3a0c, 0x2507, 0x3a0e,
+    0x1b04, 0x3a09, 0x151c, 0x3a0f, 0x3a08, 0x3a13, 0x3a12, 0x3a11,
+    0x3a14, 0x3a16, 0x1e51, 0x3a15, 0x3a19, 0x3a17, 0x3a18, 0x3950,
+    0x3a1b, 0x3a1a, 0x3958, 0x3a1c, 0x3a10, 0x1b39, 0x3a1d, 0x3a1e,
+    0x3a20, 0x3a1f, 0x3a21, 0x125e, 0x1916, 0x2a5c, 0x200f, 0x182e,
+    0x3a23, 0x3a26, 0x2932, 0x153f, 0x3a25, 0x3a24, 0x2734, 0x3a27,
+    0x1615, 0x3a29, 0x3a28, 0x141a, 0x1b16, 0x2638, 0x1729, 0x1f54,
+    0x3a2a, 0x2010, 0x2508, 0x293f, 0x3a2b, 0x3a2c, 0x3a2d, 0x2a18,
+    0x353d, 0x2026, 0x292c, 0x1a38, 0x2845, 0x2823, 0x252d, 0x2e21,
+    0x3a2f, 0x1c30, 0x3a30, 0x1016, 0x1634, 0x202d, 0x2940, 0x3a31,
+    0x1b22, 0x2327, 0x1b3b, 0x1f17, 0x3a32, 0x2a5d, 0x1157, 0x1b3c,
+    0x3a35, 0x3a33, 0x3a36, 0x2e19, 0x3a34, 0x205b, 0x3a37, 0x2212,
+    0x3a38, 0x145a, 0x3a3a, 0x3a39, 0x3a3b, 0x3a3c, 0x145b, 0x265c,
+    0x2316, 0x154c, 0x1b3d, 0x2141, 0x1d3c, 0x1010, 0x3a3d, 0x1202,
+    0x3a41, 0x1917, 0x3a40, 0x1a0b, 0x1e1a, 0x3a3f, 0x1e1b, 0x2c20,
+    0x1a0a, 0x1037, 0x202e, 0x3a46, 0x2011, 0x1127, 0x1d35, 0x2b46,
+    0x1a52, 0x1e1c, 0x2007, 0x5908, 0x3a45, 0x3a43, 0x3a44, 0x234b,
+    0x3b06, 0x3a4a, 0x1b5e, 0x1918, 0x3a48, 0x3a49, 0x1f18, 0x3a47,
+    0x1b0f, 0x3a4c, 0x3a4b, 0x3a50, 0x3a51, 0x3a4d, 0x1302, 0x3a4e,
+    0x3a4f, 0x2835, 0x2941, 0x172a, 0x3a52, 0x2012, 0x1e1d, 0x2332,
+    0x1627, 0x3a53, 0x3a57, 0x122b, 0x3a54, 0x3a56, 0x3a55, 0x1d4b,
+    0x2328, 0x1025, 0x3a58, 0x3a59, 0x240a, 0x2e51, 0x1b23, 0x2a4b,
+    0x2b1d, 0x3b02, 0x3a5b, 0x3a5e, 0x3a5d, 0x3a5a, 0x3b01, 0x263e,
+    0x3a5c, 0x3b03, 0x1d4c, 0x3b04, 0x2d2b, 0x2758, 0x3b05, 0x3b07,
+    0x3b08, 0x3b09, 0x162a, 0x1128, 0x1919, 0x3b0a, 0x3b0b, 0x1d51,
+    0x2142, 0x590b, 0x3238, 0x211e, 0x211d, 0x2238, 0x1a27, 0x3052,
+    0x174e, 0x2d0d, 0x2a5e, 0x295e, 0x3b0c, 0x1a53, 0x241f, 0x3b0d,
+    0x2f0f, 0x2b1e, 0x240b, 0x3b0e, 0x145c, 0x3b0f, 0x3b10, 0x2c3a,
+    0x2c04, 0x2b56, 0x2b3c, 0x1b05, 0x3b12, 0x1c4b, 0x2b31, 0x3b14,
+    0x3b17, 0x3b16, 0x1459, 0x1540, 0x3b13, 0x3b15, 0x3b18, 0x1f59,
+    0x2d5b, 0x1029, 0x1a40, 0x221c, 0x1c3d, 0x1e53, 0x3b1b, 0x252e,
+    0x3b19, 0x220b, 0x3b1a, 0x1e52, 0x2c3d, 0x3b1c, 0x3b1d, 0x2d48,
+    0x3b22, 0x191a, 0x2735, 0x3b1f, 0x254c, 0x3a3e, 0x3a42, 0x152f,
+    0x2727, 0x3b21, 0x1e1e, 0x2824, 0x3b27, 0x285a, 0x3b1e, 0x3b24,
+    0x3b23, 0x202f, 0x2b4d, 0x2e33, 0x2b47, 0x122c, 0x1b3e, 0x2f28,
+    0x3b26, 0x1f55, 0x3b25, 0x3b20, 0x182f, 0x3b2c, 0x3b2a, 0x122d,
+    0x3b28, 0x3b2e, 0x3b34, 0x2228, 0x2a21, 0x3b36, 0x2902, 0x3b35,
+    0x2750, 0x2b1f, 0x141b, 0x2057, 0x1d20, 0x2433, 0x2d0e, 0x3b31,
+    0x3b30, 0x3b32, 0x3b2f, 0x3b37, 0x3b2d, 0x3b2b, 0x3b33, 0x3b29,
+    0x234c, 0x2c58, 0x1c26, 0x1a54, 0x1a1a, 0x2b4f, 0x1321, 0x242e,
+    0x262a, 0x1129, 0x2052, 0x2014, 0x170a, 0x3b39, 0x191b, 0x135c,
+    0x3b3b, 0x1354, 0x3b41, 0x3b3e, 0x2053, 0x132b, 0x1a0c, 0x132a,
+    0x1a2f, 0x3b3c, 0x1745, 0x172b, 0x254d, 0x3b3a, 0x1026, 0x3b3d,
+    0x3b3f, 0x162d, 0x170c, 0x141c, 0x152b, 0x3b42, 0x1a59, 0x2b51,
+    0x1b17, 0x3b43, 0x2910, 0x3b4f, 0x1213, 0x3b44, 0x3b55, 0x3b45,
+    0x2e22, 0x3b4c, 0x273f, 0x3b54, 0x3b47, 0x1014, 0x3b49, 0x191c,
+    0x3b4b, 0x3b4a, 0x3b46, 0x3b51, 0x1e1f, 0x344d, 0x1848, 0x2d5c,
+    0x3b48, 0x2454, 0x1303, 0x1a0d, 0x3b40, 0x3b50, 0x1341, 0x3b4e,
+    0x3b52, 0x254e, 0x145e, 0x3c12, 0x5909, 0x2c29, 0x3b57, 0x145d,
+    0x3b5e, 0x2b20, 0x3c01, 0x3c03, 0x3c07, 0x3b59, 0x230a, 0x254f,
+    0x3c0b, 0x3b5c, 0x3c08, 0x3c02, 0x1f19, 0x3c0c, 0x2013, 0x3c0a,
+    0x141d, 0x2f30, 0x3b56, 0x3c06, 0x1038, 0x3b58, 0x2c1a, 0x3b5d,
+    0x1f02, 0x2427, 0x3b53, 0x3c05, 0x1f5a, 0x3c0f, 0x1351, 0x1801,
+    0x3c11, 0x3b5a, 0x3c10, 0x3c09, 0x3b5b, 0x3c0d, 0x3c0e, 0x3c1f,
+    0x262e, 0x3c04, 0x3c1b, 0x3c1d, 0x2438, 0x2d2c, 0x2956, 0x3c18,
+    0x222a, 0x3c1e, 0x211f, 0x3c15, 0x3c22, 0x3c21, 0x264f, 0x3c20,
+    0x264a, 0x3c24, 0x3c17, 0x1628, 0x3c1a, 0x1d3d, 0x2740, 0x3c1c,
+    0x162b, 0x3c14, 0x3c16, 0x3c13, 0x2f10, 0x133a, 0x3c19, 0x3c23,
+    0x1315, 0x1a47, 0x113d, 0x3c34, 0x2f11, 0x3c37, 0x1f1a, 0x3c36,
+    0x3c35, 0x3c32, 0x3c26, 0x3c43, 0x3c25, 0x3c38, 0x3c30, 0x3c2b,
+    0x3c28, 0x3c29, 0x3c31, 0x5402, 0x3c2e, 0x191d, 0x2428, 0x2144,
+    0x3c2c, 0x3c27, 0x3c2a, 0x2d2d, 0x2b4a, 0x3c2f, 0x3c39, 0x3c41,
+    0x3c3a, 0x3c47, 0x3c45, 0x3c40, 0x3c3f, 0x2430, 0x2145, 0x3c3d,
+    0x3c3b, 0x3c42, 0x3c48, 0x2855, 0x3c4e, 0x3c49, 0x3c4c, 0x3c46,
+    0x2354, 0x2918, 0x3c3c, 0x3c44, 0x1e20, 0x2c2f, 0x3c58, 0x3c4b,
+    0x1802, 0x1203, 0x133f, 0x3c33, 0x1e21, 0x3c50, 0x3c57, 0x1c59,
+    0x1352, 0x230e, 0x3c4d, 0x3c52, 0x3c56, 0x1616, 0x152c, 0x3c54,
+    0x1501, 0x262b, 0x3c53, 0x3c55, 0x3c4f, 0x3c51, 0x1340, 0x2329,
+    0x3c5c, 0x3c5a, 0x1849, 0x3c59, 0x3d01, 0x3b38, 0x3c5b, 0x3c5d,
+    0x3c5e, 0x3d0c, 0x3d08, 0x3b4d, 0x3d07, 0x3d06, 0x3d03, 0x3c4a,
+    0x3d05, 0x3d04, 0x3d0a, 0x2f06, 0x3d0d, 0x165b, 0x3d09, 0x3d0b,
+    0x2807, 0x3d0e, 0x3d12, 0x3d0f, 0x2d53, 0x3d10, 0x3c3e, 0x3d13,
+    0x3d14, 0x1115, 0x3d16, 0x1747, 0x1c01, 0x1635, 0x1204, 0x2d3f,
+    0x3d18, 0x3d17, 0x3d1a, 0x151d, 0x1636, 0x141e, 0x3d1d, 0x3d1c,
+    0x3d1e, 0x122e, 0x2317, 0x3d1f, 0x141f, 0x3d21, 0x3d20, 0x3d22,
+    0x3d23, 0x3d24, 0x1b3f, 0x2015, 0x1a01, 0x2950, 0x2a42, 0x2f24,
+    0x1b55, 0x1a30, 0x2e52, 0x3d25, 0x3d26, 0x1b40, 0x3d27, 0x3d28,
+    0x3d2a, 0x3d29, 0x2b38, 0x1d3e, 0x1c4c, 0x1b24, 0x3d2b, 0x3d2d,
+    0x1f03, 0x3d2c, 0x3d2e, 0x3d2f, 0x3d30, 0x3d31, 0x3d32, 0x3d34,
+    0x3d33, 0x3d35, 0x1205, 0x232a, 0x3d36, 0x1b06, 0x132c, 0x3d37,
+    0x2522, 0x342c, 0x1503, 0x3d38, 0x3d39, 0x2a4c, 0x2b48, 0x2627,
+    0x3d3a, 0x2846, 0x285b, 0x2c33, 0x3d3b, 0x3d3d, 0x3d3c, 0x3d3f,
+    0x3d3e, 0x3d41, 0x1b41, 0x2c11, 0x3d42, 0x3d43, 0x1504, 0x3d44,
+    0x3d46, 0x3d45, 0x1f45, 0x2919, 0x112a, 0x2825, 0x2455, 0x1d21,
+    0x1541, 0x2826, 0x1c0e, 0x3d48, 0x1420, 0x1158, 0x2652, 0x3d47,
+    0x191e, 0x2333, 0x3d49, 0x3d51, 0x3d4a, 0x2221, 0x1542, 0x3d52,
+    0x1748, 0x1505, 0x3d50, 0x3d4e, 0x3d4b, 0x2d40, 0x2420, 0x2639,
+    0x3d4c, 0x3d54, 0x3d53, 0x1703, 0x120d, 0x1a1b, 0x3d4d, 0x3d4f,
+    0x2b37, 0x2254, 0x2b57, 0x3d5c, 0x3d5d, 0x122f, 0x2a08, 0x2c5d,
+    0x3e01, 0x1c03, 0x1e22, 0x3d58, 0x3d5e, 0x1148, 0x1617, 0x3d55,
+    0x3d5a, 0x2054, 0x2751, 0x2847, 0x3d57, 0x2b01, 0x3d59, 0x3e04,
+    0x3e02, 0x3d5b, 0x2b02, 0x2728, 0x1543, 0x2505, 0x234d, 0x3e05,
+    0x3e03, 0x2239, 0x3d56, 0x112b, 0x2d2e, 0x3e10, 0x3e0f, 0x2056,
+    0x3e0c, 0x2d4c, 0x2616, 0x3e06, 0x2425, 0x112c, 0x191f, 0x3e09,
+    0x1d07, 0x3e0e, 0x3e0d, 0x3e08, 0x3e0b, 0x1348, 0x3e0a, 0x2729,
+    0x2e0e, 0x1e54, 0x2055, 0x3e16, 0x3e14, 0x292d, 0x3e11, 0x3e13,
+    0x111a, 0x1920, 0x2f12, 0x131d, 0x2942, 0x2d41, 0x1304, 0x1f1b,
+    0x3e15, 0x3e1a, 0x1e23, 0x2d10, 0x3e17, 0x3e12, 0x3e18, 0x2e3e,
+    0x2553, 0x2622, 0x1316, 0x1135, 0x3e1e, 0x3e21, 0x2e23, 0x2d44,
+    0x3e28, 0x3e22, 0x3e1f, 0x2e34, 0x3e25, 0x1d2a, 0x3e27, 0x3e2c,
+    0x2551, 0x3e2a, 0x3e24, 0x2318, 0x3e2b, 0x3e20, 0x3e26, 0x3e2d,
+    0x105c, 0x3e23, 0x3e2e, 0x1f1c, 0x1d3f, 0x2a05, 0x1a0e, 0x3e1b,
+    0x3e29, 0x251a, 0x2016, 0x1349, 0x1a31, 0x1e24, 0x3e1d, 0x1d22,
+    0x172c, 0x3e1c, 0x3e32, 0x1d4d, 0x181a, 0x3e41, 0x3e3b, 0x1554,
+    0x252f, 0x3e36, 0x3e3f, 0x100f, 0x1112, 0x1219, 0x3e38, 0x220c,
+    0x3e2f, 0x3e31, 0x1921, 0x3e42, 0x3e3d, 0x3e35, 0x3e3c, 0x2c0b,
+    0x3e3a, 0x3e3e, 0x1830, 0x1e25, 0x2319, 0x3e34, 0x2d0f, 0x3e37,
+    0x3e30, 0x2552, 0x3e33, 0x3e39, 0x2f31, 0x1c1e, 0x2b5e, 0x3e43,
+    0x280e, 0x3e4f, 0x181b, 0x1d40, 0x3e45, 0x2e0f, 0x1922, 0x3e52,
+    0x104e, 0x3e50, 0x3e44, 0x3e4a, 0x3e4c, 0x2d2f, 0x3e47, 0x250e,
+    0x3e49, 0x3e51, 0x3e4b, 0x2c27, 0x3e46, 0x1c02, 0x3e5e, 0x134a,
+    0x3e48, 0x3e4d, 0x3e4e, 0x224c, 0x223a, 0x3e56, 0x3e5c, 0x3e5a,
+    0x2509, 0x3f03, 0x3e57, 0x3e58, 0x3e40, 0x1559, 0x291a, 0x1c1f,
+    0x1957, 0x2f13, 0x3e54, 0x3f02, 0x1149, 0x2146, 0x2759, 0x1421,
+    0x2e5a, 0x2c01, 0x2432, 0x3e5b, 0x3e5d, 0x2112, 0x3f01, 0x3e59,
+    0x3e53, 0x1423, 0x1749, 0x3f0f, 0x3f0a, 0x2058, 0x1343, 0x1d41,
+    0x3f13, 0x3f0c, 0x240c, 0x3f09, 0x2439, 0x3f2c, 0x3f06, 0x3f05,
+    0x3f0e, 0x3f08, 0x3f07, 0x3f0d, 0x2001, 0x3f04, 0x3f10, 0x3f11,
+    0x1422, 0x3f16, 0x3f15, 0x3f17, 0x3f1a, 0x2523, 0x3f14, 0x3f18,
+    0x1743, 0x2259, 0x3f12, 0x271b, 0x3f19, 0x3f1e, 0x3f1c, 0x3f1f,
+    0x3f22, 0x3f1b, 0x194a, 0x2708, 0x3e19, 0x2d54, 0x3f1d, 0x3f21,
+    0x2255, 0x3f20, 0x3f0b, 0x4f49, 0x3f25, 0x3f29, 0x3f27, 0x3f23,
+    0x3f24, 0x3f28, 0x3f26, 0x292e, 0x3f2e, 0x3f2b, 0x3f2a, 0x3f2d,
+    0x2634, 0x3f2f, 0x2355, 0x224d, 0x2005, 0x3f30, 0x3f32, 0x3f31,
+    0x3e55, 0x3f33, 0x2647, 0x3f34, 0x1230, 0x2554, 0x1305, 0x1544,
+    0x1c3e, 0x1a32, 0x2f07, 0x1f46, 0x114a, 0x3f36, 0x3f35, 0x3f39,
+    0x231a, 0x3f3c, 0x3f37, 0x3f3b, 0x3f3a, 0x2520, 0x1039, 0x5907,
+    0x2e55, 0x3f3e, 0x1108, 0x3f40, 0x3f3f, 0x3f3d, 0x3f38, 0x2b03,
+    0x3f42, 0x3f41, 0x114b, 0x3f44, 0x2a12, 0x3f43, 0x2c15, 0x1e27,
+    0x2113, 0x1e26, 0x2e5b, 0x3f4a, 0x2059, 0x3f46, 0x3f4b, 0x114c,
+    0x3f49, 0x2741, 0x3f45, 0x3f48, 0x1e28, 0x2831, 0x3f4c, 0x1c31,
+    0x205a, 0x3f4f, 0x3f47, 0x1707, 0x3f4d, 0x2d30, 0x3f50, 0x5406,
+    0x1d2f, 0x3f51, 0x3f52, 0x270e, 0x3f54, 0x3f55, 0x2713, 0x2555,
+    0x3f57, 0x3f59, 0x2e35, 0x3f56, 0x3f58, 0x114d, 0x3f53, 0x333b,
+    0x3f5a, 0x2147, 0x1b18, 0x3f5c, 0x3f5b, 0x1f04, 0x3239, 0x3f5d,
+    0x4001, 0x3f4e, 0x3f5e, 0x4002, 0x275a, 0x4003, 0x4004, 0x4005,
+    0x4006, 0x243e, 0x4008, 0x4007, 0x4009, 0x400a, 0x1c3f, 0x2943,
+    0x2c4c, 0x400b, 0x400c, 0x2136, 0x1c04, 0x400d, 0x400e, 0x400f,
+    0x2a32, 0x2827, 0x4010, 0x2737, 0x240d, 0x4011, 0x1247, 0x154d,
+    0x2c26, 0x2c16, 0x1214, 0x2f14, 0x2b32, 0x2a0a, 0x2017, 0x4012,
+    0x2623, 0x1803, 0x4013, 0x1a34, 0x4015, 0x4014, 0x4016, 0x4017,
+    0x4018, 0x151e, 0x4019, 0x401a, 0x1804, 0x2828, 0x401c, 0x1e55,
+    0x401b, 0x1618, 0x401d, 0x401f, 0x401e, 0x4020, 0x1831, 0x4021,
+    0x1649, 0x2120, 0x195d, 0x4023, 0x4024, 0x4022, 0x1c4d, 0x2628,
+    0x1619, 0x4026, 0x230c, 0x4025, 0x2f15, 0x2742, 0x4029, 0x402b,
+    0x4028, 0x2c34, 0x402a, 0x402c, 0x2e24, 0x4030, 0x402f, 0x2356,
+    0x270d, 0x1805, 0x402e, 0x402d, 0x2d11, 0x2d12, 0x4031, 0x114e,
+    0x1956, 0x1b42, 0x4032, 0x4033, 0x4035, 0x1d23, 0x4037, 0x4036,
+    0x4038, 0x132d, 0x403a, 0x4039, 0x403c, 0x403b, 0x181c, 0x2e08,
+    0x162c, 0x1206, 0x164a, 0x1441, 0x2e48, 0x403e, 0x4040, 0x4041,
+    0x1231, 0x403d, 0x1b19, 0x2421, 0x403f, 0x4044, 0x1c4e, 0x4042,
+    0x171e, 0x2829, 0x4043, 0x405e, 0x4049, 0x181d, 0x1545, 0x4046,
+    0x2d5d, 0x2e10, 0x2256, 0x4048, 0x404a, 0x2e36, 0x1637, 0x285c,
+    0x272a, 0x404b, 0x404d, 0x4050, 0x404c, 0x404f, 0x184a, 0x112d,
+    0x4051, 0x1f50, 0x404e, 0x2e3c, 0x4054, 0x5404, 0x4052, 0x4055,
+    0x4047, 0x4053, 0x1a1c, 0x4056, 0x4057, 0x2d5e, 0x4058, 0x4059,
+    0x4045, 0x405a, 0x1424, 0x1c05, 0x405b, 0x405c, 0x405d, 0x111b,
+    0x4101, 0x291b, 0x4102, 0x1404, 0x4103, 0x4104, 0x4105, 0x4107,
+    0x4108, 0x4106, 0x2933, 0x410a, 0x4109, 0x410c, 0x410b, 0x410d,
+    0x410e, 0x4110, 0x410f, 0x1959, 0x4112, 0x4111, 0x1425, 0x1f33,
+    0x251c, 0x4113, 0x2018, 0x1b1a, 0x1159, 0x4114, 0x2d31, 0x2a43,
+    0x4115, 0x594c, 0x2524, 0x2d13, 0x1923, 0x1f1d, 0x232b, 0x3214,
+    0x240e, 0x1248, 0x4116, 0x4117, 0x411c, 0x411a, 0x4119, 0x3a22,
+    0x1306, 0x4118, 0x103a, 0x280a, 0x282a, 0x2e11, 0x411d, 0x411b,
+    0x233c, 0x2006, 0x280b, 0x290d, 0x411f, 0x2e0c, 0x172d, 0x4120,
+    0x411e, 0x2836, 0x4121, 0x4122, 0x103b, 0x1e56, 0x4127, 0x4124,
+    0x264d, 0x4123, 0x1506, 0x412a, 0x4125, 0x4126, 0x4129, 0x4128,
+    0x2905, 0x2122, 0x2121, 0x151f, 0x412b, 0x412c, 0x412d, 0x412f,
+    0x412e, 0x1136, 0x4137, 0x2848, 0x4131, 0x4133, 0x4135, 0x1f1e,
+    0x4136, 0x4134, 0x1c20, 0x4130, 0x4132, 0x2922, 0x1e29, 0x4139,
+    0x4138, 0x413a, 0x1c06, 0x1a0f, 0x2557, 0x413b, 0x242b, 0x413d,
+    0x2e01, 0x413c, 0x2149, 0x4142, 0x4144, 0x4145, 0x2334, 0x4143,
+    0x4140, 0x413e, 0x413f, 0x4141, 0x4148, 0x4146, 0x4147, 0x4149,
+    0x414b, 0x414c, 0x414d, 0x414e, 0x414a, 0x4150, 0x414f, 0x4151,
+    0x2e25, 0x4154, 0x4152, 0x4153, 0x1442, 0x2c5e, 0x2a2a, 0x4156,
+    0x4155, 0x4157, 0x4158, 0x415c, 0x4159, 0x415a, 0x415b, 0x415d,
+    0x415e, 0x4201, 0x4202, 0x4203, 0x280f, 0x2530, 0x4204, 0x2752,
+    0x2914, 0x4205, 0x4206, 0x250a, 0x1307, 0x1924, 0x4207, 0x4208,
+    0x4209, 0x1b09, 0x420b, 0x420a, 0x420c, 0x420d, 0x2849, 0x420e,
+    0x420f, 0x5349, 0x4210, 0x4211, 0x4212, 0x1b0e, 0x4213, 0x2736,
+    0x2b3f, 0x112e, 0x1137, 0x4214, 0x4216, 0x4215, 0x2550, 0x2019,
+    0x3d19, 0x4217, 0x2c21, 0x4218, 0x1426, 0x2837, 0x4219, 0x421a,
+    0x421b, 0x2c3c, 0x2c35, 0x241e, 0x214a, 0x421d, 0x1d42, 0x1e2a,
+    0x4220, 0x421f, 0x421e, 0x285d, 0x1427, 0x1809, 0x4226, 0x4223,
+    0x1f1f, 0x2c12, 0x4222, 0x4224, 0x4225, 0x4221, 0x4227, 0x4228,
+    0x240f, 0x1443, 0x2345, 0x4229, 0x422a, 0x422d, 0x1f47, 0x2624,
+    0x422e, 0x2b33, 0x422b, 0x422c, 0x4231, 0x4230, 0x422f, 0x4233,
+    0x4232, 0x4234, 0x4236, 0x4235, 0x2a2d, 0x1d36, 0x2e26, 0x4237,
+    0x2617, 0x4238, 0x4239, 0x423d, 0x423b, 0x423c, 0x423a, 0x423e,
+    0x423f, 0x4240, 0x4241, 0x2c17, 0x4242, 0x2c50, 0x4243, 0x232e,
+    0x274a, 0x164b, 0x231b, 0x4244, 0x161a, 0x2030, 0x4245, 0x1a1d,
+    0x4246, 0x4247, 0x1806, 0x1a35, 0x4249, 0x2536, 0x1a36, 0x152e,
+    0x2b04, 0x272b, 0x2537, 0x193c, 0x424b, 0x1e2b, 0x2e12, 0x1925,
+    0x1807, 0x2803, 0x424d, 0x424f, 0x184b, 0x424e, 0x2456, 0x4251,
+    0x1317, 0x424c, 0x284a, 0x1110, 0x1a4c, 0x2f32, 0x4250, 0x4252,
+    0x2a2b, 0x2039, 0x4254, 0x4255, 0x4253, 0x132e, 0x425b, 0x425a,
+    0x1c07, 0x425c, 0x4257, 0x425d, 0x4258, 0x2838, 0x4256, 0x4259,
+    0x4302, 0x4301, 0x2b41, 0x425e, 0x104b, 0x4304, 0x4303, 0x1e2c,
+    0x4305, 0x2123, 0x4307, 0x4306, 0x4308, 0x4248, 0x424a, 0x430a,
+    0x4309, 0x1c08, 0x2e49, 0x1c32, 0x430b, 0x1717, 0x1520, 0x1507,
+    0x1b43, 0x2d14, 0x4311, 0x4310, 0x2124, 0x430d, 0x430f, 0x1d2b,
+    0x1f20, 0x430e, 0x430c, 0x270a, 0x1e2d, 0x291c, 0x1a37, 0x2558,
+    0x4312, 0x4313, 0x4329, 0x1638, 0x2f1d, 0x2115, 0x4314, 0x1232,
+    0x2457, 0x2a01, 0x4315, 0x155a, 0x4316, 0x4318, 0x4319, 0x2709,
+    0x431a, 0x431b, 0x431c, 0x1639, 0x1233, 0x2625, 0x1d08, 0x1b44,
+    0x431d, 0x1d09, 0x122a, 0x2923, 0x431e, 0x284b, 0x2125, 0x4321,
+    0x4322, 0x2749, 0x1f21, 0x431f, 0x2341, 0x4320, 0x1e2e, 0x103c,
+    0x1509, 0x4323, 0x2458, 0x4324, 0x2027, 0x2c0d, 0x2903, 0x4325,
+    0x4326, 0x2335, 0x2e27, 0x4328, 0x4327, 0x1c4f, 0x432a, 0x1050,
+    0x432d, 0x432b, 0x1234, 0x172e, 0x432c, 0x1926, 0x1952, 0x2a46,
+    0x432e, 0x2b34, 0x4330, 0x2031, 0x112f, 0x121a, 0x100c, 0x432f,
+    0x4331, 0x4332, 0x1e57, 0x4333, 0x132f, 0x4335, 0x174a, 0x1546,
+    0x4336, 0x1655, 0x4337, 0x205c, 0x262d, 0x2040, 0x1a55, 0x4338,
+    0x2342, 0x214b, 0x433a, 0x433c, 0x4339, 0x433b, 0x1702, 0x433d,
+    0x1706, 0x1547, 0x2d32, 0x433f, 0x4340, 0x110e, 0x4343, 0x1356,
+    0x4342, 0x4341, 0x4345, 0x433e, 0x4346, 0x2e09, 0x4347, 0x4348,
+    0x3454, 0x434a, 0x4349, 0x434b, 0x434c, 0x2e15, 0x434d, 0x504f,
+    0x1e2f, 0x434e, 0x434f, 0x1d37, 0x2618, 0x4350, 0x2308, 0x4351,
+    0x231c, 0x4352, 0x1605, 0x311f, 0x233d, 0x1c13, 0x1428, 0x4353,
+    0x4402, 0x4356, 0x1548, 0x4355, 0x4404, 0x4354, 0x1e30, 0x4358,
+    0x4359, 0x250b, 0x435a, 0x133e, 0x1f3a, 0x2944, 0x435c, 0x2248,
+    0x4357, 0x435b, 0x435d, 0x1a5b, 0x4406, 0x290e, 0x2806, 0x2559,
+    0x163a, 0x4405, 0x4403, 0x2815, 0x435e, 0x233e, 0x255b, 0x255a,
+    0x1a56, 0x4418, 0x4408, 0x440a, 0x440d, 0x440e, 0x440b, 0x440c,
+    0x4409, 0x4407, 0x4401, 0x2a2f, 0x1235, 0x4415, 0x4412, 0x4417,
+    0x4416, 0x2753, 0x2c07, 0x1b1b, 0x4410, 0x4419, 0x4414, 0x4413,
+    0x440f, 0x4411, 0x1429, 0x231d, 0x205d, 0x2802, 0x441e, 0x2804,
+    0x2041, 0x441b, 0x282f, 0x441f, 0x2a33, 0x233b, 0x441a, 0x441c,
+    0x441d, 0x4420, 0x1c24, 0x2626, 0x4425, 0x4424, 0x4421, 0x2f16,
+    0x442a, 0x442e, 0x442b, 0x4427, 0x4428, 0x442d, 0x4422, 0x3235,
+    0x4429, 0x4423, 0x442c, 0x4432, 0x142a, 0x442f, 0x4430, 0x4431,
+    0x4434, 0x4433, 0x2856, 0x4435, 0x2e5c, 0x2a4d, 0x443a, 0x4437,
+    0x4436, 0x2032, 0x4439, 0x443b, 0x4438, 0x443f, 0x443c, 0x443d,
+    0x4426, 0x443e, 0x4440, 0x4441, 0x2a26, 0x4442, 0x2c42, 0x162e,
+    0x1709, 0x4443, 0x2a14, 0x1f48, 0x2c10, 0x4444, 0x2e13, 0x2754,
+    0x2126, 0x2714, 0x1d2d, 0x1020, 0x4449, 0x4447, 0x4445, 0x1401,
+    0x1e31, 0x444a, 0x4448, 0x4446, 0x444e, 0x444d, 0x444c, 0x444b,
+    0x444f, 0x4450, 0x201a, 0x4451, 0x4453, 0x4452, 0x1832, 0x2118,
+    0x4455, 0x255c, 0x4454, 0x4456, 0x2a15, 0x214c, 0x1927, 0x4457,
+    0x2e28, 0x4459, 0x445a, 0x445b, 0x445c, 0x1b45, 0x445d, 0x172f,
+    0x154a, 0x150a, 0x4501, 0x2c53, 0x1928, 0x445e, 0x4504, 0x2c46,
+    0x271c, 0x2913, 0x1d43, 0x4503, 0x1c33, 0x1929, 0x1b46, 0x1549,
+    0x2a16, 0x4502, 0x2127, 0x2b22, 0x1a57, 0x1b47, 0x243d, 0x4507,
+    0x2e3f, 0x1a39, 0x4508, 0x1f22, 0x450a, 0x1e32, 0x1a10, 0x4509,
+    0x1d0a, 0x181e, 0x2128, 0x4505, 0x450b, 0x4506, 0x1730, 0x450e,
+    0x4512, 0x174b, 0x450d, 0x4516, 0x192a, 0x2d4d, 0x101c, 0x4513,
+    0x154b, 0x4510, 0x4511, 0x255d, 0x450f, 0x450c, 0x1308, 0x2044,
+    0x1808, 0x4518, 0x4515, 0x4517, 0x4514, 0x1731, 0x2213, 0x4519,
+    0x214e, 0x4526, 0x4522, 0x451c, 0x4520, 0x1c5a, 0x103d, 0x451b,
+    0x4523, 0x4527, 0x192b, 0x2c36, 0x2436, 0x451d, 0x4525, 0x451a,
+    0x231e, 0x451f, 0x101d, 0x2c2a, 0x451e, 0x163b, 0x284c, 0x214d,
+    0x2e30, 0x1d4f, 0x454e, 0x4528, 0x205e, 0x4524, 0x4529, 0x452b,
+    0x2459, 0x452e, 0x452a, 0x2a34, 0x142b, 0x2c2b, 0x103e, 0x452d,
+    0x2e5d, 0x452c, 0x114f, 0x264c, 0x452f, 0x4536, 0x4530, 0x4537,
+    0x4533, 0x275b, 0x1c2a, 0x4535, 0x4532, 0x4538, 0x4531, 0x1d24,
+    0x2b05, 0x1d2c, 0x4534, 0x4540, 0x453c, 0x453f, 0x453d, 0x4541,
+    0x453b, 0x4521, 0x2033, 0x282b, 0x453e, 0x4539, 0x2101, 0x1732,
+    0x1d0b, 0x1f05, 0x2116, 0x4544, 0x4546, 0x4547, 0x4543, 0x4545,
+    0x453a, 0x4542, 0x454a, 0x4549, 0x2b5a, 0x170b, 0x4548, 0x454c,
+    0x454b, 0x454f, 0x4551, 0x1b1c, 0x454d, 0x4552, 0x4553, 0x5901,
+    0x4554, 0x455a, 0x251b, 0x4556, 0x4555, 0x4557, 0x4558, 0x4559,
+    0x455b, 0x455c, 0x142c, 0x455d, 0x455e, 0x4601, 0x4602, 0x4603,
+    0x4604, 0x4605, 0x4606, 0x4608, 0x4607, 0x4609, 0x460a, 0x460b,
+    0x460e, 0x460c, 0x460d, 0x1a41, 0x1733, 0x2336, 0x2813, 0x1d50,
+    0x272d, 0x284d, 0x460f, 0x384d, 0x4610, 0x4612, 0x2d45, 0x4611,
+    0x4614, 0x4613, 0x2d33, 0x4615, 0x285e, 0x4616, 0x4619, 0x4618,
+    0x4617, 0x461a, 0x1712, 0x2102, 0x1521, 0x461e, 0x461b, 0x461c,
+    0x461f, 0x4620, 0x461d, 0x1109, 0x1207, 0x4622, 0x4623, 0x4624,
+    0x2d42, 0x1d0c, 0x4626, 0x4625, 0x1f49, 0x4627, 0x4628, 0x4629,
+    0x1445, 0x142d, 0x462a, 0x462b, 0x2b3d, 0x2d43, 0x2d34, 0x2f17,
+    0x192d, 0x462e, 0x1c34, 0x462d, 0x462f, 0x1c09, 0x2231, 0x4630,
+    0x192c, 0x2c37, 0x4631, 0x4632, 0x4633, 0x4634, 0x4635, 0x1c0a,
+    0x2c4d, 0x4637, 0x231f, 0x4636, 0x4639, 0x4638, 0x463a, 0x201b,
+    0x463b, 0x463c, 0x2a19, 0x463d, 0x214f, 0x463e, 0x463f, 0x2e5e,
+    0x4642, 0x4641, 0x4640, 0x2410, 0x4643, 0x1f06, 0x4644, 0x4645,
+    0x2f18, 0x4646, 0x4647, 0x4649, 0x4648, 0x2805, 0x2659, 0x2f1e,
+    0x2809, 0x464b, 0x1e33, 0x290a, 0x464c, 0x464a, 0x142e, 0x1834,
+    0x1b48, 0x284e, 0x180a, 0x2b23, 0x464f, 0x464d, 0x192e, 0x192f,
+    0x1049, 0x1a48, 0x2739, 0x103f, 0x4654, 0x2320, 0x2738, 0x223b,
+    0x4656, 0x4652, 0x4655, 0x4650, 0x4653, 0x2b06, 0x1835, 0x105d,
+    0x4651, 0x4658, 0x4659, 0x2619, 0x161b, 0x4706, 0x271d, 0x1b49,
+    0x161c, 0x2028, 0x2f26, 0x2c0e, 0x4657, 0x2034, 0x1533, 0x465a,
+    0x465c, 0x465b, 0x465d, 0x2306, 0x271e, 0x2411, 0x4703, 0x4702,
+    0x465e, 0x1f35, 0x2945, 0x4705, 0x4704, 0x1930, 0x2f33, 0x4715,
+    0x4709, 0x470a, 0x1c50, 0x4708, 0x1958, 0x4707, 0x470b, 0x2412,
+    0x2a02, 0x2103, 0x223c, 0x470f, 0x4710, 0x470c, 0x470d, 0x470e,
+    0x1931, 0x4716, 0x4712, 0x2946, 0x2b4c, 0x2908, 0x4711, 0x4714,
+    0x4713, 0x2b24, 0x4717, 0x4718, 0x2117, 0x4719, 0x471b, 0x471f,
+    0x471c, 0x471a, 0x271f, 0x471d, 0x471e, 0x1212, 0x4725, 0x4720,
+    0x4721, 0x4722, 0x2201, 0x4724, 0x4723, 0x4726, 0x4727, 0x4728,
+    0x1f23, 0x1249, 0x4729, 0x2e37, 0x1c0b, 0x1d0d, 0x1b4a, 0x2337,
+    0x472a, 0x472b, 0x1111, 0x472c, 0x472d, 0x472e, 0x472f, 0x4730,
+    0x161d, 0x3a0a, 0x4731, 0x2045, 0x4732, 0x1c2b, 0x4733, 0x3010,
+    0x4734, 0x2a3e, 0x143c, 0x2104, 0x1d38, 0x2951, 0x1d0e, 0x4735,
+    0x1932, 0x4736, 0x282c, 0x4744, 0x4738, 0x2229, 0x2755, 0x181f,
+    0x4737, 0x2105, 0x4739, 0x245a, 0x473b, 0x473a, 0x473d, 0x473c,
+    0x473e, 0x4740, 0x473f, 0x142f, 0x4741, 0x4742, 0x4743, 0x1a11,
+    0x2e29, 0x4745, 0x1f07, 0x1150, 0x4746, 0x4747, 0x4748, 0x1052,
+    0x4749, 0x474a, 0x2947, 0x1c27, 0x474c, 0x1309, 0x1012, 0x474b,
+    0x474e, 0x272e, 0x1f24, 0x1236, 0x2b07, 0x173d, 0x163c, 0x474d,
+    0x124a, 0x1403, 0x1151, 0x4752, 0x2e4a, 0x223d, 0x2924, 0x475e,
+    0x1237, 0x475c, 0x475a, 0x4751, 0x474f, 0x4750, 0x1c43, 0x164c,
+    0x2357, 0x2631, 0x1131, 0x4754, 0x4753, 0x4759, 0x4755, 0x4758,
+    0x2c30, 0x4757, 0x1238, 0x135d, 0x475b, 0x475d, 0x1734, 0x4803,
+    0x480c, 0x480d, 0x100b, 0x4814, 0x1051, 0x480b, 0x480a, 0x4805,
+    0x4804, 0x4802, 0x4801, 0x2343, 0x225b, 0x4807, 0x4806, 0x4809,
+    0x2150, 0x1735, 0x1121, 0x4808, 0x1933, 0x2151, 0x481a, 0x481b,
+    0x1239, 0x120e, 0x4818, 0x480e, 0x4816, 0x481d, 0x4817, 0x4815,
+    0x4756, 0x4813, 0x480f, 0x1430, 0x4811, 0x481c, 0x4812, 0x481e,
+    0x4810, 0x275c, 0x2d49, 0x4819, 0x482f, 0x4827, 0x1f5b, 0x1526,
+    0x163d, 0x4822, 0x123b, 0x1e34, 0x4825, 0x1a3a, 0x2531, 0x482a,
+    0x2a4e, 0x4821, 0x123a, 0x1836, 0x2909, 0x482b, 0x481f, 0x4828,
+    0x4832, 0x4823, 0x4824, 0x261a, 0x4829, 0x4826, 0x2b08, 0x482c,
+    0x1040, 0x4820, 0x482e, 0x482d, 0x274b, 0x4834, 0x483f, 0x135e,
+    0x4842, 0x4830, 0x4835, 0x2d4e, 0x483e, 0x2d35, 0x2e0a, 0x2358,
+    0x134b, 0x2952, 0x4844, 0x2601, 0x1011, 0x483d, 0x4839, 0x2152,
+    0x4833, 0x483b, 0x4840, 0x270c, 0x100a, 0x4838, 0x4841, 0x2958,
+    0x483c, 0x4837, 0x1e35, 0x1d0f, 0x1c0c, 0x2c38, 0x2927, 0x4847,
+    0x4850, 0x483a, 0x1357, 0x1e58, 0x4845, 0x484a, 0x2153, 0x4846,
+    0x484d, 0x233f, 0x484e, 0x2d36, 0x4843, 0x1318, 0x4849, 0x484c,
+    0x2c0c, 0x484f, 0x4848, 0x484b, 0x5905, 0x2b09, 0x2f01, 0x4853,
+    0x485a, 0x4852, 0x1c23, 0x4831, 0x2a2e, 0x2c02, 0x4859, 0x4858,
+    0x4854, 0x4855, 0x1116, 0x4857, 0x4851, 0x2435, 0x4856, 0x105e,
+    0x2202, 0x2a23, 0x485b, 0x4901, 0x2839, 0x485e, 0x1e36, 0x1c29,
+    0x4903, 0x161e, 0x4904, 0x2959, 0x485d, 0x4836, 0x485c, 0x2f2f,
+    0x2602, 0x2953, 0x490b, 0x4911, 0x4912, 0x4905, 0x2756, 0x490f,
+    0x4907, 0x4909, 0x4913, 0x4908, 0x490c, 0x1152, 0x2645, 0x490d,
+    0x4910, 0x4906, 0x2106, 0x490a, 0x1b07, 0x1f25, 0x1710, 0x2c54,
+    0x2c59, 0x1d52, 0x4917, 0x4915, 0x2f2e, 0x4914, 0x2d55, 0x4916,
+    0x4918, 0x4919, 0x491c, 0x491a, 0x2603, 0x491b, 0x282d, 0x490e,
+    0x1d53, 0x491d, 0x4922, 0x2154, 0x4921, 0x4902, 0x4923, 0x2129,
+    0x491e, 0x4920, 0x491f, 0x3d11, 0x3d02, 0x4925, 0x4924, 0x2d56,
+    0x421c, 0x4926, 0x4927, 0x4928, 0x1837, 0x1534, 0x492a, 0x313d,
+    0x1555, 0x2e1a, 0x1653, 0x492b, 0x492c, 0x234e, 0x492d, 0x265a,
+    0x101a, 0x1243, 0x4932, 0x4933, 0x492e, 0x1b1d, 0x492f, 0x2722,
+    0x4930, 0x4931, 0x493b, 0x4935, 0x4938, 0x4934, 0x4936, 0x4937,
+    0x1c38, 0x4939, 0x2321, 0x1736, 0x1322, 0x493c, 0x131f, 0x4941,
+    0x493d, 0x4940, 0x281a, 0x493e, 0x493f, 0x2928, 0x283a, 0x4942,
+    0x225d, 0x494c, 0x4948, 0x124b, 0x4946, 0x2b0a, 0x4947, 0x4944,
+    0x4945, 0x494a, 0x494d, 0x494b, 0x4949, 0x4943, 0x2338, 0x4954,
+    0x2c0a, 0x4952, 0x4953, 0x494e, 0x4950, 0x4951, 0x494f, 0x2046,
+    0x2f19, 0x4958, 0x4959, 0x4a01, 0x1f0a, 0x495b, 0x495e, 0x4956,
+    0x4955, 0x4a02, 0x123c, 0x495c, 0x4a03, 0x495d, 0x495a, 0x2413,
+    0x4957, 0x2748, 0x4a07, 0x2d1b, 0x4a06, 0x4a05, 0x4a0e, 0x4a08,
+    0x4a10, 0x2d46, 0x4a13, 0x4a0a, 0x4a0b, 0x4a0f, 0x4a12, 0x4a11,
+    0x4a09, 0x4a0c, 0x4a1d, 0x4a16, 0x4a14, 0x4a15, 0x4a1a, 0x4a1b,
+    0x130a, 0x1522, 0x4a19, 0x4a04, 0x4a18, 0x4a1c, 0x4a17, 0x4a1e,
+    0x4a20, 0x4a1f, 0x4a22, 0x4a21, 0x493a, 0x4a26, 0x4a23, 0x4a24,
+    0x4a25, 0x4a27, 0x174c, 0x4a29, 0x4a28, 0x1d10, 0x1934, 0x3e07,
+    0x4a2a, 0x1d31, 0x1319, 0x4a2b, 0x1132, 0x1e37, 0x4a2c, 0x1935,
+    0x4a2d, 0x1041, 0x291d, 0x4a2e, 0x1f4a, 0x4a35, 0x4a32, 0x234f,
+    0x4a33, 0x4a30, 0x163e, 0x4a2f, 0x4a36, 0x1716, 0x223e, 0x4a3c,
+    0x4a38, 0x2215, 0x4a37, 0x4a3a, 0x4a31, 0x4a3b, 0x4a3d, 0x284f,
+    0x4a39, 0x4a3e, 0x4a40, 0x1833, 0x4a34, 0x1021, 0x4a3f, 0x1a3b,
+    0x2e56, 0x4a41, 0x4a42, 0x2155, 0x2e02, 0x4a43, 0x2d15, 0x4a44,
+    0x4a45, 0x2a44, 0x4a46, 0x1a20, 0x2e03, 0x4a4b, 0x4a4c, 0x1e38,
+    0x4a4a, 0x2d47, 0x4a47, 0x4a49, 0x201d, 0x1f5e, 0x4a48, 0x4a4d,
+    0x2a03, 0x4a4f, 0x4a4e, 0x134c, 0x2b0b, 0x4a50, 0x5902, 0x4a5c,
+    0x4a52, 0x4a53, 0x4a54, 0x4a55, 0x4a59, 0x4a5a, 0x4a58, 0x4a56,
+    0x4a51, 0x4a57, 0x4a5b, 0x5017, 0x1208, 0x4a5e, 0x163f, 0x4a5d,
+    0x4b02, 0x4b01, 0x4b04, 0x4b03, 0x4b05, 0x1d11, 0x4b06, 0x4b07,
+    0x4b08, 0x201e, 0x2d37, 0x4b09, 0x2a04, 0x2726, 0x4b0a, 0x4b0b,
+    0x180b, 0x150c, 0x4b0c, 0x1b4b, 0x2721, 0x4b0d, 0x1330, 0x4b0e,
+    0x4b10, 0x2d57, 0x4b0f, 0x1f26, 0x4b11, 0x4b12, 0x4b13, 0x1431,
+    0x4b14, 0x4b15, 0x4b16, 0x4b17, 0x1331, 0x4b18, 0x4b19, 0x4b1a,
+    0x1252, 0x1f08, 0x4b1b, 0x4b1c, 0x4b1d, 0x1820, 0x245b, 0x4b1e,
+    0x1737, 0x1f36, 0x4b21, 0x2604, 0x4b20, 0x1711, 0x4b1f, 0x2257,
+    0x150d, 0x4b22, 0x4b23, 0x1e39, 0x174d, 0x4b24, 0x2b0c, 0x203f,
+    0x1556, 0x2c55, 0x212a, 0x4b25, 0x1f27, 0x2350, 0x1e3a, 0x4b26,
+    0x4b29, 0x4b2a, 0x1a1e, 0x2222, 0x4b28, 0x1e3b, 0x291e, 0x4b27,
+    0x1b4c, 0x1133, 0x4b2e, 0x1738, 0x1b4e, 0x1b4d, 0x2f2d, 0x4b2d,
+    0x4b2c, 0x2107, 0x152d, 0x2f23, 0x131a, 0x1e3c, 0x4b2b, 0x4b30,
+    0x4b31, 0x4b2f, 0x1838, 0x2d20, 0x1b4f, 0x2707, 0x4b34, 0x2020,
+    0x2322, 0x2d16, 0x4b37, 0x184c, 0x201f, 0x4b33, 0x4b38, 0x184d,
+    0x4b35, 0x4b36, 0x4b32, 0x2042, 0x2629, 0x230f, 0x123d, 0x2850,
+    0x1523, 0x2414, 0x4b3b, 0x4b39, 0x232c, 0x2021, 0x1432, 0x4b3a,
+    0x1f3b, 0x2e2a, 0x2f20, 0x4b3c, 0x4b47, 0x2415, 0x4b46, 0x4b43,
+    0x4b4b, 0x4b44, 0x4b40, 0x245c, 0x4b3f, 0x4b3d, 0x2d01, 0x1b50,
+    0x4b41, 0x4b3e, 0x4b45, 0x1d54, 0x1821, 0x225a, 0x2b25, 0x113a,
+    0x1042, 0x2605, 0x4b49, 0x4b48, 0x2646, 0x4b4d, 0x4b42, 0x4b4c,
+    0x4b4e, 0x180c, 0x4b4a, 0x1936, 0x1c35, 0x4b4f, 0x2d38, 0x4b52,
+    0x4b55, 0x4b53, 0x2915, 0x4b50, 0x1640, 0x4b54, 0x4b56, 0x4b5a,
+    0x4b57, 0x4b59, 0x4b58, 0x4b5b, 0x1c11, 0x4b5d, 0x4b5c, 0x2948,
+    0x4c01, 0x1739, 0x4b5e, 0x4c02, 0x4c03, 0x1524, 0x4621, 0x1e59,
+    0x4c04, 0x184e, 0x4c05, 0x4c06, 0x1b1e, 0x3a2e, 0x4c07, 0x4c08,
+    0x1d12, 0x4c09, 0x4c0a, 0x4c0b, 0x4c0c, 0x4c0d, 0x230b, 0x4c0e,
+    0x4c10, 0x4c0f, 0x2606, 0x4c11, 0x2b0d, 0x4c12, 0x4c13, 0x4c14,
+    0x4c15, 0x263a, 0x1e3d, 0x4c16, 0x194b, 0x300e, 0x4c17, 0x4c18,
+    0x291f, 0x4c19, 0x4c21, 0x4c1a, 0x4c1c, 0x4c1b, 0x4c1d, 0x2b26,
+    0x4c1e, 0x4c1f, 0x4c20, 0x4c22, 0x130d, 0x2447, 0x2949, 0x1a42,
+    0x1937, 0x292f, 0x123f, 0x282e, 0x4c25, 0x1433, 0x2035, 0x4c24,
+    0x4c29, 0x2359, 0x2c43, 0x4c27, 0x4c28, 0x150e, 0x4c2a, 0x2743,
+    0x223f, 0x2851, 0x251d, 0x4c26, 0x2b27, 0x124c, 0x4c2c, 0x2f08,
+    0x2422, 0x2f25, 0x1b51, 0x4c2b, 0x2211, 0x4c3c, 0x2108, 0x2658,
+    0x2930, 0x4c2f, 0x1b1f, 0x1b52, 0x1e3e, 0x2745, 0x180d, 0x4c2e,
+    0x4c2d, 0x294a, 0x1c21, 0x2532, 0x4c31, 0x4c32, 0x1938, 0x4c30,
+    0x4c33, 0x4c34, 0x4c36, 0x2203, 0x4c35, 0x1446, 0x4c38, 0x4c37,
+    0x4c39, 0x4c3b, 0x4c3d, 0x4c3e, 0x2036, 0x1c2f, 0x4c3f, 0x1332,
+    0x4c40, 0x2156, 0x4c41, 0x4c42, 0x294b, 0x150f, 0x4c43, 0x2416,
+    0x113b, 0x4c44, 0x1c51, 0x1f56, 0x220d, 0x4c47, 0x4c46, 0x4c45,
+    0x4c4d, 0x4c4b, 0x4c48, 0x4c4a, 0x4c49, 0x4c4c, 0x1557, 0x4c50,
+    0x2037, 0x4c51, 0x1839, 0x4c4e, 0x4c4f, 0x2f09, 0x2417, 0x2109,
+    0x4c52, 0x4c55, 0x4c53, 0x4c54, 0x2d39, 0x2607, 0x4c58, 0x4c56,
+    0x4c57, 0x4c59, 0x4d09, 0x4c5c, 0x4c5d, 0x4c5b, 0x4c5a, 0x245d,
+    0x4d01, 0x4d05, 0x4d02, 0x4c5e, 0x4d03, 0x4d04, 0x4d0b, 0x4d06,
+    0x2038, 0x4d08, 0x4d0a, 0x4d07, 0x4d0d, 0x1d13, 0x4d0c, 0x4d0e,
+    0x4d0f, 0x4d12, 0x4d11, 0x4d10, 0x4d14, 0x4d13, 0x2c56, 0x4d16,
+    0x4d15, 0x4d17, 0x4d18, 0x4d1a, 0x4d19, 0x1f28, 0x4d1b, 0x164d,
+    0x4d1c, 0x4d1e, 0x4d1f, 0x4d20, 0x4d1d, 0x4d21, 0x1c36, 0x4d22,
+    0x1510, 0x1713, 0x180e, 0x4d23, 0x2650, 0x251e, 0x4d24, 0x4d27,
+    0x1c14, 0x4d26, 0x4d25, 0x173a, 0x4d28, 0x1333, 0x4d2a, 0x1a3c,
+    0x4d29, 0x4d32, 0x4d2c, 0x4d2e, 0x2a45, 0x4d2b, 0x4d2d, 0x4d31,
+    0x4d2f, 0x1511, 0x4d30, 0x4d33, 0x273a, 0x2e38, 0x1d14, 0x4d34,
+    0x2d02, 0x4d36, 0x4d35, 0x4d39, 0x2d21, 0x4d38, 0x134d, 0x4d37,
+    0x4d3c, 0x4d3b, 0x4d3a, 0x2512, 0x4d3d, 0x4d3e, 0x4d3f, 0x194c,
+    0x1705, 0x4d40, 0x4d41, 0x4d42, 0x1f29, 0x4d43, 0x1c0d, 0x4d44,
+    0x4d45, 0x3201, 0x315e, 0x4d46, 0x4550, 0x4d47, 0x2304, 0x1f0b,
+    0x2720, 0x4d48, 0x2a35, 0x2434, 0x195e, 0x2309, 0x110a, 0x2b58,
+    0x1f37, 0x173e, 0x1641, 0x2a36, 0x4d49, 0x4d4b, 0x4d4a, 0x1240,
+    0x2656, 0x4d4c, 0x2757, 0x2513, 0x4d4d, 0x1d32, 0x4d4f, 0x2c22,
+    0x4d5e, 0x4d51, 0x4d52, 0x2429, 0x2240, 0x2157, 0x2608, 0x4d50,
+    0x1535, 0x4d59, 0x4d56, 0x4e05, 0x2609, 0x2340, 0x4d53, 0x245e,
+    0x2533, 0x4d54, 0x4d58, 0x1f40, 0x2747, 0x242c, 0x2022, 0x4d57,
+    0x220e, 0x2204, 0x4d55, 0x1009, 0x2f02, 0x4d5a, 0x2241, 0x1d15,
+    0x1f2a, 0x4d5c, 0x4d5b, 0x104f, 0x4d5d, 0x290f, 0x4e07, 0x263b,
+    0x1f4b, 0x2339, 0x1658, 0x4e06, 0x2d17, 0x111f, 0x2a37, 0x1241,
+    0x4e01, 0x4e02, 0x4e03, 0x4e04, 0x261b, 0x2303, 0x1043, 0x4e08,
+    0x4e09, 0x5403, 0x221d, 0x4e0a, 0x1153, 0x212c, 0x180f, 0x2d3a,
+    0x4e0b, 0x250c, 0x2158, 0x1c37, 0x4e0c, 0x4e0f, 0x1d45, 0x4e0d,
+    0x210b, 0x210a, 0x1044, 0x2e2b, 0x4e11, 0x2852, 0x4e13, 0x4e12,
+    0x4e10, 0x4344, 0x1434, 0x4d4e, 0x4e15, 0x4e14, 0x4e16, 0x2d18,
+    0x2641, 0x2b0e, 0x4e17, 0x1c39, 0x4e18, 0x4e19, 0x4e1a, 0x2501,
+    0x104a, 0x1939, 0x2f1a, 0x4e1e, 0x1714, 0x4e1b, 0x4e1c, 0x2954,
+    0x1334, 0x2d19, 0x161f, 0x2534, 0x4e1f, 0x4e20, 0x4e21, 0x2502,
+    0x4e23, 0x4e22, 0x2633, 0x4e24, 0x1d16, 0x1c40, 0x273b, 0x2351,
+    0x1c52, 0x1f4c, 0x4e25, 0x4e26, 0x1f3d, 0x4e27, 0x4e28, 0x4e29,
+    0x2d4f, 0x1d17, 0x4e2b, 0x4e2a, 0x193a, 0x1953, 0x1b20, 0x4e2e,
+    0x1d46, 0x4e2d, 0x4e2c, 0x2249, 0x184f, 0x2023, 0x2810, 0x1d19,
+    0x4e2f, 0x1e3f, 0x4e32, 0x4e30, 0x4e31, 0x4e34, 0x4e33, 0x1e5a,
+    0x4e35, 0x4e36, 0x4e37, 0x2830, 0x1a33, 0x1c41, 0x4e38, 0x4e39,
+    0x2e04, 0x1d25, 0x2c4e, 0x2e2c, 0x4e3a, 0x1642, 0x4e3b, 0x2503,
+    0x4e3e, 0x1358, 0x1f2b, 0x4e3c, 0x4e3d, 0x2440, 0x2b35, 0x165c,
+    0x4e40, 0x4e41, 0x4e3f, 0x4e43, 0x263f, 0x1323, 0x4e47, 0x4e44,
+    0x4e46, 0x4e42, 0x4f2f, 0x4e45, 0x2e4b, 0x183a, 0x4e4f, 0x2514,
+    0x4e4a, 0x4e4d, 0x4e4b, 0x4e50, 0x4e51, 0x4e49, 0x4e56, 0x1154,
+    0x4e48, 0x280d, 0x4e4c, 0x1e40, 0x193b, 0x2b28, 0x1644, 0x1d26,
+    0x261c, 0x5904, 0x210d, 0x4e54, 0x4e4e, 0x4e53, 0x2c23, 0x2418,
+    0x4e55, 0x4e52, 0x210c, 0x4e59, 0x4e58, 0x4e57, 0x2b0f, 0x1d5b,
+    0x4e5a, 0x2a3f, 0x1134, 0x2926, 0x2352, 0x1558, 0x590a, 0x4e5c,
+    0x193d, 0x1b0c, 0x4e5b, 0x1f4d, 0x1f4e, 0x4f01, 0x4f03, 0x1e5b,
+    0x4f02, 0x4f04, 0x1633, 0x2925, 0x1c42, 0x2f03, 0x4e5e, 0x1a58,
+    0x2f1f, 0x4f06, 0x4f05, 0x4f07, 0x4e5d, 0x5903, 0x2649, 0x2535,
+    0x2437, 0x4f0c, 0x2323, 0x4f08, 0x4f09, 0x170d, 0x4f0b, 0x1810,
+    0x4f0a, 0x1e41, 0x1359, 0x4f10, 0x1a1f, 0x2159, 0x242a, 0x131b,
+    0x4f0e, 0x4f0f, 0x2423, 0x4f0d, 0x4f11, 0x4f17, 0x4f1a, 0x4f19,
+    0x250d, 0x4f12, 0x4f13, 0x4f16, 0x4f18, 0x1620, 0x4f1b, 0x4f15,
+    0x4f14, 0x4f1f, 0x4f20, 0x4f21, 0x4f1e, 0x4f1d, 0x1e42, 0x260a,
+    0x4f1c, 0x4f25, 0x4f23, 0x4f24, 0x4f22, 0x2258, 0x4f26, 0x4f27,
+    0x4f29, 0x1435, 0x4f28, 0x2c5a, 0x4f34, 0x4f2a, 0x4f2d, 0x4f2b,
+    0x4f2c, 0x4f2e, 0x4f30, 0x4f31, 0x4f32, 0x4f35, 0x4f33, 0x4f36,
+    0x4f38, 0x4f37, 0x2419, 0x2c47, 0x4f39, 0x210e, 0x4f3a, 0x2a24,
+    0x4f3b, 0x130b, 0x111c, 0x1437, 0x1436, 0x4f3c, 0x4f3d, 0x4f3e,
+    0x4f3f, 0x4f40, 0x1438, 0x1335, 0x193e, 0x2816, 0x4f42, 0x4f41,
+    0x4f43, 0x113c, 0x4f46, 0x4f45, 0x4f44, 0x4f47, 0x4f4a, 0x1027,
+    0x4f48, 0x4f4c, 0x4f4b, 0x4f4e, 0x4f4d, 0x4f4f, 0x260e, 0x4f50,
+    0x4f51, 0x4f53, 0x4f52, 0x294c, 0x4f54, 0x4f55, 0x1a45, 0x4f56,
+    0x4f57, 0x2b29, 0x212b, 0x1004, 0x222b, 0x4f58, 0x294d, 0x4f5b,
+    0x4f59, 0x193f, 0x4f5a, 0x1822, 0x2a25, 0x4f5d, 0x5001, 0x4f5e,
+    0x5002, 0x1101, 0x1f38, 0x1d5c, 0x1439, 0x5003, 0x2746, 0x5005,
+    0x1102, 0x5004, 0x2424, 0x2e2d, 0x260b, 0x4f5c, 0x2e06, 0x1811,
+    0x2d3b, 0x1659, 0x2e14, 0x1708, 0x2242, 0x4701, 0x5006, 0x130c,
+    0x1f4f, 0x1336, 0x5008, 0x5009, 0x5007, 0x1744, 0x1a3d, 0x1e43,
+    0x1103, 0x2e39, 0x500b, 0x4e0e, 0x500a, 0x500e, 0x500c, 0x500d,
+    0x500f, 0x5010, 0x2e4c, 0x5011, 0x5012, 0x2029, 0x281b, 0x1f5d,
+    0x1447, 0x2d1a, 0x124d, 0x1d18, 0x183b, 0x5015, 0x5014, 0x1b53,
+    0x5016, 0x5013, 0x1b08, 0x501a, 0x4a0d, 0x3236, 0x1f57, 0x5018,
+    0x2e05, 0x2651, 0x110b, 0x2043, 0x1c16, 0x2a17, 0x1120, 0x2e4d,
+    0x2d4b, 0x501b, 0x2525, 0x1c5b, 0x501c, 0x501d, 0x1f2c, 0x501e,
+    0x2e4e, 0x5019, 0x5020, 0x5022, 0x5021, 0x501f, 0x5023, 0x5024,
+    0x215a, 0x1242, 0x5025, 0x2c18, 0x5026, 0x5027, 0x2f0a, 0x3b11,
+    0x5028, 0x5029, 0x502a, 0x502e, 0x502b, 0x502c, 0x502d, 0x502f,
+    0x2024, 0x2c57, 0x2025, 0x5030, 0x2853, 0x5031, 0x5333, 0x2c2c,
+    0x5032, 0x5033, 0x5034, 0x1337, 0x5036, 0x1f39, 0x5037, 0x1704,
+    0x5038, 0x503c, 0x503a, 0x503b, 0x1353, 0x5039, 0x503d, 0x503e,
+    0x1028, 0x503f, 0x5040, 0x1e44, 0x5041, 0x1527, 0x5044, 0x5043,
+    0x5042, 0x4b51, 0x2a3c, 0x5045, 0x5046, 0x5047, 0x5048, 0x5049,
+    0x504a, 0x143a, 0x504b, 0x504c, 0x2703, 0x504e, 0x121b, 0x5051,
+    0x5050, 0x1104, 0x1621, 0x2a27, 0x241a, 0x1a02, 0x1940, 0x1d47,
+    0x1f3c, 0x5053, 0x5052, 0x2d22, 0x1448, 0x2832, 0x263c, 0x1f5c,
+    0x2e2e, 0x173b, 0x5056, 0x5055, 0x2b2b, 0x260c, 0x1130, 0x5057,
+    0x5054, 0x2931, 0x2d4a, 0x5058, 0x5059, 0x505b, 0x224a, 0x133b,
+    0x133c, 0x505a, 0x1449, 0x1812, 0x144a, 0x251f, 0x2e40, 0x183c,
+    0x505c, 0x505d, 0x505e, 0x5101, 0x5103, 0x5102, 0x2957, 0x5104,
+    0x5105, 0x5106, 0x5107, 0x5109, 0x5108, 0x510a, 0x2854, 0x462c,
+    0x1f09, 0x1512, 0x510b, 0x510c, 0x320c, 0x3d1b, 0x2833, 0x105b,
+    0x101b, 0x1b54, 0x2b10, 0x1e5e, 0x510d, 0x2c3f, 0x510e, 0x2d3c,
+    0x1122, 0x1b21, 0x510f, 0x124e, 0x5110, 0x5111, 0x5113, 0x5114,
+    0x5116, 0x5112, 0x5115, 0x143b, 0x5117, 0x5118, 0x5119, 0x511a,
+    0x511b, 0x511d, 0x511c, 0x511f, 0x5122, 0x511e, 0x5120, 0x5121,
+    0x5123, 0x1622, 0x1c53, 0x5124, 0x5125, 0x1941, 0x5126, 0x131e,
+    0x272f, 0x5127, 0x5128, 0x233a, 0x264b, 0x5129, 0x275d, 0x222c,
+    0x1138, 0x164e, 0x164f, 0x2353, 0x512e, 0x1650, 0x124f, 0x512d,
+    0x512b, 0x512c, 0x512a, 0x5138, 0x512f, 0x5130, 0x5131, 0x5132,
+    0x5134, 0x5133, 0x1d39, 0x5135, 0x5137, 0x1513, 0x5136, 0x215b,
+    0x1813, 0x5139, 0x222d, 0x513a, 0x260d, 0x513b, 0x5140, 0x513e,
+    0x513d, 0x513f, 0x513c, 0x5142, 0x5141, 0x5144, 0x1623, 0x5143,
+    0x5145, 0x5146, 0x5148, 0x5147, 0x5149, 0x514b, 0x514a, 0x195c,
+    0x514c, 0x514d, 0x131c, 0x514e, 0x514f, 0x1f51, 0x5150, 0x5151,
+    0x5152, 0x5153, 0x1942, 0x5154, 0x5155, 0x5156, 0x5157, 0x5158,
+    0x2811, 0x515a, 0x2906, 0x515b, 0x5159, 0x515d, 0x515c, 0x515e,
+    0x5201, 0x5202, 0x5203, 0x5204, 0x5205, 0x5206, 0x5207, 0x5208,
+    0x5209, 0x520a, 0x520b, 0x520c, 0x520d, 0x520e, 0x3d15, 0x520f,
+    0x4458, 0x1514, 0x1301, 0x1a12, 0x5211, 0x5210, 0x2c05, 0x5213,
+    0x5214, 0x5212, 0x5215, 0x2b42, 0x5216, 0x155b, 0x2f05, 0x5217,
+    0x5219, 0x101e, 0x521a, 0x2a0b, 0x5218, 0x521b, 0x521c, 0x521d,
+    0x521e, 0x521f, 0x2b4e, 0x1b0d, 0x1a5a, 0x210f, 0x5220, 0x5223,
+    0x5221, 0x5224, 0x1851, 0x5222, 0x5225, 0x5226, 0x5227, 0x522b,
+    0x1b0a, 0x2244, 0x522c, 0x5229, 0x5228, 0x522a, 0x173f, 0x5230,
+    0x522f, 0x522e, 0x1013, 0x523a, 0x5236, 0x5237, 0x5233, 0x5239,
+    0x5235, 0x1342, 0x2f2c, 0x5238, 0x5234, 0x5232, 0x5231, 0x523c,
+    0x523f, 0x523e, 0x523d, 0x2929, 0x523b, 0x1053, 0x5240, 0x5242,
+    0x134f, 0x522d, 0x1117, 0x5244, 0x5243, 0x5241, 0x230d, 0x2b50,
+    0x2e3a, 0x5245, 0x5246, 0x5247, 0x5248, 0x5249, 0x241b, 0x524a,
+    0x2817, 0x524f, 0x524b, 0x524c, 0x2b11, 0x2c24, 0x2630, 0x5250,
+    0x5251, 0x261e, 0x524e, 0x524d, 0x120a, 0x5259, 0x5258, 0x1155,
+    0x5256, 0x5255, 0x5253, 0x135b, 0x5252, 0x1c12, 0x1209, 0x1943,
+    0x525c, 0x525b, 0x525a, 0x5257, 0x525d, 0x525e, 0x5305, 0x5304,
+    0x5306, 0x110d, 0x5301, 0x5302, 0x1954, 0x2c19, 0x5303, 0x2b12,
+    0x530b, 0x5307, 0x530c, 0x5309, 0x5308, 0x173c, 0x530d, 0x530e,
+    0x530f, 0x530a, 0x5254, 0x5310, 0x2441, 0x5314, 0x5315, 0x5313,
+    0x5312, 0x5318, 0x5311, 0x5316, 0x5317, 0x531a, 0x5319, 0x531c,
+    0x531d, 0x531e, 0x2f29, 0x531b, 0x224b, 0x1a4d, 0x531f, 0x5320,
+    0x5321, 0x5322, 0x5323, 0x1814, 0x5324, 0x5325, 0x1c0f, 0x5326,
+    0x5327, 0x5328, 0x5329, 0x532c, 0x532a, 0x2f1c, 0x532b, 0x2e4f,
+    0x532d, 0x2e3b, 0x532e, 0x275e, 0x532f, 0x5331, 0x5332, 0x5330,
+    0x194d, 0x2c2d, 0x2b43, 0x3657, 0x3d40, 0x2b5b, 0x120b, 0x5334,
+    0x1530, 0x5335, 0x5336, 0x5337, 0x1955, 0x5338, 0x4034, 0x2c3b,
+    0x2243, 0x5339, 0x533b, 0x533a, 0x533c, 0x533d, 0x533e, 0x533f,
+    0x5340, 0x5341, 0x5342, 0x5343, 0x5344, 0x5345, 0x5346, 0x5347,
+    0x5348, 0x2504, 0x183d, 0x534a, 0x212d, 0x534b, 0x534c, 0x2901,
+    0x534d, 0x534e, 0x4317, 0x4c3a, 0x504d, 0x534f, 0x5350, 0x5352,
+    0x5353, 0x5354, 0x2e50, 0x5351, 0x5355, 0x5356, 0x5358, 0x5357,
+    0x535a, 0x535b, 0x5359, 0x2e16, 0x535c, 0x535d, 0x4334, 0x535e,
+    0x5934, 0x593f, 0x5940, 0x5955, 0x010a, 0x0154, 0x0150, 0x0153,
+    0x0155, 0x012a, 0x012b, 0x0156, 0x013c, 0x0104, 0x013d, 0x0105,
+    0x011f, 0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0x0316,
+    0x0317, 0x0318, 0x0319, 0x0107, 0x0108, 0x0143, 0x0141, 0x0144,
+    0x0109, 0x0157, 0x0321, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326,
+    0x0327, 0x0328, 0x0329, 0x032a, 0x032b, 0x032c, 0x032d, 0x032e,
+    0x032f, 0x0330, 0x0331, 0x0332, 0x0333, 0x0334, 0x0335, 0x0336,
+    0x0337, 0x0338, 0x0339, 0x033a, 0x012e, 0x0120, 0x012f, 0x0110,
+    0x0112, 0x010e, 0x0341, 0x0342, 0x0343, 0x0344, 0x0345, 0x0346,
+    0x0347, 0x0348, 0x0349, 0x034a, 0x034b, 0x034c, 0x034d, 0x034e,
+    0x034f, 0x0350, 0x0351, 0x0352, 0x0353, 0x0354, 0x0355, 0x0356,
+    0x0357, 0x0358, 0x0359, 0x035a, 0x0130, 0x0123, 0x0131, 0x0121,
+    0x0151, 0x0152, 0x022c, 0x0111, 0x014f,
+};
@@ -0,0 +1,156 @@
+#include "Utf8Kuten.h"
+
+unsigned short unicodeToKuten(uint32_t cp)
+{
+    const UnicodeKutenBlock *block;
+    unsigned int top, bit, rank;
+
+    if (cp >= 0x20 && cp <= 0x7E)
+        return cp;
+    if (cp > 0xFFFF)
+        return KUTEN_REPLACEMENT;
+
+    top = unicodeKutenTop[cp >> 6];
+    if (top == 0xFFFF)
+        return KUTEN_REPLACEMENT;
+    block = &unicodeKutenBlocks[top];
+    bit = cp & 63;
+
+    // rank of the code point inside the block = set bits below it
+    if (bit < 32)
+    {
+        if (!(block->maskLo & (1UL << bit)))
+            return KUTEN_REPLACEMENT;
+        rank = __builtin_popcount(block->maskLo & ((1UL << bit) - 1));
+    }
+    else
+    {
+        bit -= 32;
+        if (!(block->maskHi & (1UL << bit)))
+            return KUTEN_REPLACEMENT;
+        rank = __builtin_popcount(block->maskLo) + __builtin_popcount(block->maskHi & ((1UL << bit) - 1));
+    }
+    return unicodeKutenCodes[block->base + rank];
+}
+
+Utf8Decoder::Utf8Decoder()
+{
+    reset();
+}
+
+void Utf8Decoder::reset()
+{
+    _cp = 0;
+    _min = 0;
+    _need = 0;
+}
+
+int Utf8Decoder::put(unsigned char byte, unsigned short *kuten)
+{
+    if (_need > 0)
+    {
+        if ((byte & 0xC0) == 0x80)
+        {
+            _cp = (_cp << 6) | (byte & 0x3F);
+            if (--_need > 0)
+                return 0;
+            // overlong forms and surrogates are malformed
+            if (_cp < _min || (_cp >= 0xD800 && _cp <= 0xDFFF))
+                kuten[0] = KUTEN_REPLACEMENT;
+            else
+                kuten[0] = unicodeToKuten(_cp);
+            return 1;
+        }
+        // sequence cut short: report it, then start over with this byte
+        _need = 0;
+        kuten[0] = KUTEN_REPLACEMENT;
+        return 1 + put(byte, kuten + 1);
+    }
+
+    if (byte < 0x80)
+    {
+        kuten[0] = unicodeToKuten(byte);
+        return 1;
+    }
+    if ((byte & 0xE0) == 0xC0)
+    {
+        _cp = byte & 0x1F;
+        _min = 0x80;
+        _need = 1;
+    }
+    else if ((byte & 0xF0) == 0xE0)
+    {
+        _cp = byte & 0x0F;
+        _min = 0x800;
+        _need = 2;
+    }
+    else if ((byte & 0xF8) == 0xF0)
+    {
+        _cp = byte & 0x07;
+        _min = 0x10000;
+        _need = 3;
+    }
+    else
+    {
+        kuten[0] = KUTEN_REPLACEMENT;
+        return 1;
+    }
+    return 0;
+}
+
+const char *utf8NextKuten(const char *str, unsigned short *kuten)
+{
+    const unsigned char *p = (const unsigned char *)str;
+    uint32_t cp, min;
+    int need;
+
+    if (*p == 0)
+    {
+        *kuten = 0;
+        return str;
+    }
+    if (*p < 0x80)
+    {
+        *kuten = unicodeToKuten(*p);
+        return str + 1;
+    }
+    if ((*p & 0xE0) == 0xC0)
+    {
+        cp = *p & 0x1F;
+        min = 0x80;
+        need = 1;
+    }
+    else if ((*p & 0xF0) == 0xE0)
+    {
+        cp = *p & 0x0F;
+        min = 0x800;
+        need = 2;
+    }
+    else if ((*p & 0xF8) == 0xF0)
+    {
+        cp = *p & 0x07;
+        min = 0x10000;
+        need = 3;
+    }
+    else
+    {
+        *kuten = KUTEN_REPLACEMENT;
+        return str + 1;
+    }
+
+    for (p++; need > 0; need--, p++)
+    {
+        if ((*p & 0xC0) != 0x80)
+        {
+            // cut short: the offending byte starts the next character
+            *kuten = KUTEN_REPLACEMENT;
+            return (const char *)p;
+        }
+        cp = (cp << 6) | (*p & 0x3F);
+    }
+    if (cp < min || (cp >= 0xD800 && cp <= 0xDFFF))
+        *kuten = KUTEN_REPLACEMENT;
+    else
+        *kuten = unicodeToKuten(cp);
+    return (const char *)p;
+}
@@ -0,0 +1,68 @@
+#ifndef UTF8_KUTEN_H
+#define UTF8_KUTEN_H
+
+#include <stdint.h>
+
+#define KUTEN_REPLACEMENT 0x020E // GETA MARK, drawn for characters the ROM does not have
+
+/** One 64 code point block of the Unicode -> Ku-Ten table */
+struct UnicodeKutenBlock {
+    uint32_t maskLo; // code points 0-31 of the block present
+    uint32_t maskHi; // code points 32-63 of the block present
+    uint16_t base;   // index of the first code point of the block in unicodeKutenCodes
+};
+
+/* Two-level table generated by kutentable.py (UnicodeKutenTable.cpp) */
+extern const unsigned short unicodeKutenTop[];     // (code point >> 6) -> block, 0xFFFF = none
+extern const UnicodeKutenBlock unicodeKutenBlocks[];
+extern const unsigned short unicodeKutenCodes[];
+
+/** Map a Unicode code point to a Ku-Ten code
+ *
+ *  ASCII 0x20-0x7E maps to the half-width glyphs (Ku 0), everything in
+ *  JIS X 0208 to its full-width glyph.
+ *
+ *  @param cp Unicode code point
+ *  @return Kuten code, or KUTEN_REPLACEMENT if the font has no glyph
+ */
+unsigned short unicodeToKuten(uint32_t cp);
+
+/** Streaming UTF-8 decoder producing Ku-Ten codes
+ *
+ *  Bytes are fed one at a time, so text can be decoded straight from a
+ *  serial line or a string without a temporary buffer. Malformed input
+ *  yields KUTEN_REPLACEMENT.
+ */
+class Utf8Decoder {
+  public:
+    Utf8Decoder();
+
+    /** Feed one byte
+     *
+     *  A byte that cuts a sequence short yields KUTEN_REPLACEMENT and then
+     *  starts the next character, so up to two codes can come out at once.
+     *
+     *  @param byte Next UTF-8 byte
+     *  @param kuten Room for 2 Kuten codes
+     *  @return number of characters completed (0, 1 or 2)
+     */
+    int put(unsigned char byte, unsigned short *kuten);
+
+    /** Drop a partially decoded character */
+    void reset();
+
+  private:
+    uint32_t _cp;
+    uint32_t _min; // smallest code point allowed for the sequence length
+    int _need;     // continuation bytes still expected
+};
+
+/** Decode the next character of a NUL terminated UTF-8 string
+ *
+ *  @param str Current position
+ *  @param kuten Set to the decoded character
+ *  @return position of the next character (str itself at the terminator)
+ */
+const char *utf8NextKuten(const char *str, unsigned short *kuten);
+
+#endif
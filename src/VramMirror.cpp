@@ -0,0 +1,153 @@
+#include <string.h>
+#include "VramMirror.h"
+
+VramMirror::VramMirror(ShadowVram &vram, T6963C &lcd, WriteFunction write, void *context)
+    : _vram(vram), _lcd(lcd), _write(write), _context(context)
+{
+    memset(_remote, 0, sizeof(_remote));
+    memset(&counters, 0, sizeof(counters));
+    _outLength = 0;
+    _outSent = 0;
+    _pos = -1;
+    _keyframe = true;
+    _frame = 0;
+    _frameUs = 0;
+}
+
+void VramMirror::requestKeyframe()
+{
+    _keyframe = true;
+}
+
+bool VramMirror::poll(uint32_t nowUs)
+{
+    int length = 0;
+
+    // the port takes what it can; nothing new until the chunk is out
+    if (_outSent < _outLength)
+    {
+        send();
+        if (_outSent < _outLength)
+            return true;
+    }
+
+    if (_pos < 0)
+    {
+        if ((uint32_t)(nowUs - _frameUs) < MIRROR_FRAME_US)
+            return false;
+        _frameUs = nowUs;
+        header(_keyframe || _frame % MIRROR_KEYFRAME == 0);
+        length = MIRROR_HEADER_SIZE;
+    }
+    _outLength = length + encode(_out + length, MIRROR_CHUNK - length);
+    _outSent = 0;
+    send();
+    return _pos >= 0 || _outSent < _outLength;
+}
+
+static void put16(unsigned char *out, int value)
+{
+    out[0] = value & 0xFF;
+    out[1] = (value >> 8) & 0xFF;
+}
+
+void VramMirror::header(bool keyframe)
+{
+    if (keyframe)
+    {
+        memset(_remote, 0, sizeof(_remote));
+        _keyframe = false;
+        counters.keyframes++;
+    }
+    _out[0] = 'L';
+    _out[1] = 'M';
+    _out[2] = keyframe ? 0 : 1;
+    put16(_out + 3, _frame);
+    put16(_out + 5, _lcd.cachedState(DISP_TEXT_HOME_ADDR));
+    put16(_out + 7, _lcd.cachedState(DISP_GRPH_HOME_ADDR));
+    _out[9] = _lcd.cachedState(REG_OFFSET);
+    _out[10] = _lcd.cachedState(MODE_SET);
+    _out[11] = _lcd.cachedState(ENA_BASE);
+    _out[12] = DISPLAY_WIDTH;
+    _out[13] = DISPLAY_HEIGHT;
+    put16(_out + 14, VRAM_START);
+    put16(_out + 16, VRAM_END);
+    put16(_out + 18, CGRAM_START);
+    put16(_out + 20, CGRAM_END);
+    put16(_out + 22, 0);
+    _pos = 0;
+}
+
+// Tokens from _pos on, at most room bytes
+int VramMirror::encode(unsigned char *out, int room)
+{
+    const unsigned char *image = _vram.buffer(VRAM_START);
+    unsigned char v, x;
+    int n = 0, run, len, i;
+
+    while (_pos < SHADOW_SIZE && room - n >= 3)
+    {
+        v = image[_pos] ^ _remote[_pos];
+        if (v == 0)
+        {
+            for (run = 1; _pos + run < SHADOW_SIZE && run < 0x4000 && image[_pos + run] == _remote[_pos + run]; run++)
+                ;
+            out[n++] = 0xC0 | ((run - 1) >> 8);
+            out[n++] = (run - 1) & 0xFF;
+            _pos += run;
+            continue;
+        }
+
+        for (run = 1; _pos + run < SHADOW_SIZE && run < 65 && (image[_pos + run] ^ _remote[_pos + run]) == v; run++)
+            ;
+        if (run >= 3)
+        {
+            out[n++] = 0x80 | (run - 2);
+            out[n++] = v;
+            for (i = 0; i < run; i++)
+            {
+                _remote[_pos + i] ^= v;
+            }
+            counters.changed += run;
+            _pos += run;
+            continue;
+        }
+
+        // literals up to the next unchanged pair
+        for (len = 0; _pos + len < SHADOW_SIZE && len < 127 && n + 1 + len < room; len++)
+        {
+            x = image[_pos + len] ^ _remote[_pos + len];
+            if (x == 0 && _pos + len + 1 < SHADOW_SIZE && image[_pos + len + 1] == _remote[_pos + len + 1])
+                break;
+            out[n + 1 + len] = x;
+            _remote[_pos + len] ^= x;
+            if (x != 0)
+                counters.changed++;
+        }
+        out[n] = len;
+        n += 1 + len;
+        _pos += len;
+    }
+
+    if (_pos == SHADOW_SIZE && n < room)
+    {
+        out[n++] = 0;
+        _pos = -1;
+        _frame++;
+        counters.frames++;
+    }
+    return n;
+}
+
+void VramMirror::send()
+{
+    int sent = _write(_out + _outSent, _outLength - _outSent, _context);
+
+    if (sent <= 0)
+    {
+        counters.stalls++;
+        return;
+    }
+    _outSent += sent;
+    counters.bytes += sent;
+}
@@ -0,0 +1,102 @@
+#ifndef VRAM_MIRROR_H
+#define VRAM_MIRROR_H
+
+#include <stdint.h>
+#include "ShadowVram.h"
+
+#ifndef MIRROR_CHUNK
+#define MIRROR_CHUNK 128 // bytes encoded and offered to the port per poll()
+#endif
+#ifndef MIRROR_FRAME_US
+#define MIRROR_FRAME_US 100000 // minimum time between frame starts
+#endif
+#ifndef MIRROR_KEYFRAME
+#define MIRROR_KEYFRAME 50 // every n-th frame is a keyframe
+#endif
+
+#define MIRROR_HEADER_SIZE 24
+
+/** Statistics of a VramMirror */
+struct MirrorCounters {
+    unsigned long frames;    // frames completed
+    unsigned long keyframes; // of which keyframes
+    unsigned long bytes;     // bytes accepted by the port
+    unsigned long changed;   // shadow bytes that differed from the remote copy
+    unsigned long stalls;    // poll() calls the port accepted nothing
+};
+
+/** Streams the shadow VRAM to a remote viewer (mirrorview.py)
+ *
+ *  A frame is a header followed by the XOR of the shadow against the
+ *  copy the viewer already has, coded as skips, runs and literals. A
+ *  keyframe XORs against zeros, so it rebuilds the viewer from scratch.
+ *  poll() encodes at most MIRROR_CHUNK bytes and offers them to the port,
+ *  which may accept fewer; the rest is offered again on the next poll(),
+ *  so a slow link only makes frames take longer. Frames are encoded
+ *  while they are sent: every byte is coded from the shadow as it is when
+ *  its chunk is built, and the remote copy is updated along with it.
+ *
+ *  Only the shadow is mirrored; there is no autoDataRead read-back
+ *  source. _remote is a second SHADOW_SIZE copy, so a mirror costs about
+ *  as much RAM as the shadow itself (~26 KB each with the default map).
+ *  The target build does not use it yet: the display thread writes the
+ *  panel directly, without a shadow. The host mirror bench drives it.
+ *
+ *  Frame: "LM", type (0 key, 1 delta), frame number, text home, graphics
+ *  home, offset, mode, display, width, height, VRAM start/end, CGRAM
+ *  start/end (16-bit values little-endian), reserved, then tokens:
+ *
+ *      0x00            end of frame
+ *      0x01-0x7F n     n XOR bytes follow
+ *      0x80-0xBF v     ((token & 0x3F) + 2) bytes XOR v
+ *      0xC0-0xFF lo    ((token & 0x3F) << 8 | lo) + 1 bytes unchanged
+ */
+class VramMirror {
+  public:
+    /** Port output: returns the number of bytes accepted (0 .. length) */
+    typedef int (*WriteFunction)(const void *data, int length, void *context);
+
+    /** Create a mirror of a shadow
+     *
+     *  @param vram Shadow that is mirrored
+     *  @param lcd Driver whose cached registers go into the frame header
+     *  @param write Port output
+     *  @param context Passed to write
+     */
+    VramMirror(ShadowVram &vram, T6963C &lcd, WriteFunction write, void *context);
+    virtual ~VramMirror() {};
+
+    /** Send the next chunk, starting a frame if MIRROR_FRAME_US passed
+     *
+     *  @param nowUs Current time in us
+     *  @return true while a frame is in progress
+     */
+    bool poll(uint32_t nowUs);
+
+    /** Make the next frame a keyframe (e.g. a viewer connected) */
+    void requestKeyframe();
+
+    MirrorCounters counters;
+
+  private:
+    void header(bool keyframe);
+    int encode(unsigned char *out, int room);
+    void send();
+
+    ShadowVram &_vram;
+    T6963C &_lcd;
+    WriteFunction _write;
+    void *_context;
+
+    unsigned char _remote[SHADOW_SIZE]; // what the viewer has
+    unsigned char _out[MIRROR_CHUNK];
+    int _outLength;
+    int _outSent;
+
+    int _pos; // next shadow index of the frame, -1 = no frame in progress
+    bool _keyframe;
+    uint16_t _frame;
+    uint32_t _frameUs;
+};
+
+#endif
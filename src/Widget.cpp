@@ -0,0 +1,399 @@
+#include <stdio.h>
+#include <string.h>
+#include "Widget.h"
+#include "TextLayout.h"
+#include "Utf8Kuten.h"
+
+// Part of [start, start + extent) on [0, limit)
+static int clipExtent(int start, int extent, int limit)
+{
+    if (start < 0 || start >= limit || extent < 0)
+        return 0;
+    return extent > limit - start ? limit - start : extent;
+}
+
+Widget::Widget(int x, int y, int width, int height)
+    : _x(x), _y(y), _width(clipExtent(x, width, DISPLAY_WIDTH)), _height(clipExtent(y, height, DISPLAY_HEIGHT)),
+      _dirty(true)
+{
+}
+
+bool Widget::key(WidgetKey)
+{
+    return false;
+}
+
+void Widget::highlight(int *x, int *y, int *width)
+{
+    *x = _x;
+    *y = _y;
+    *width = _width;
+}
+
+Label::Label(int x, int y, int width, const char *text, int height) : Widget(x, y, width, height)
+{
+    _text[0] = 0;
+    setText(text);
+}
+
+void Label::setText(const char *text)
+{
+    if (strncmp(_text, text, sizeof(_text) - 1) == 0)
+        return;
+    strncpy(_text, text, sizeof(_text) - 1);
+    _text[sizeof(_text) - 1] = 0;
+    invalidate();
+}
+
+void Label::draw(WidgetScreen &screen)
+{
+    CgramAllocator *cgram = screen.cgram();
+    unsigned short code;
+    const char *str;
+    int x, columns;
+
+    if (_height < 2 || cgram == NULL)
+    {
+        screen.text(_x, _y, _text, _width);
+        return;
+    }
+
+    // Release everything first: glyphs still on screen are shared again
+    // and the text codes that do not change are not sent
+    for (x = _x; x < _x + _width; x++)
+    {
+        cgram->erase(x, _y);
+    }
+    screen.text(_x, _y, "", _width);
+    screen.text(_x, _y + 1, "", _width);
+    x = _x;
+    for (str = utf8NextKuten(_text, &code); code != 0; str = utf8NextKuten(str, &code))
+    {
+        columns = TextLayout::charWidth(code) / 8;
+        if (x + columns > _x + _width)
+            break;
+        cgram->putChar(x, _y, code);
+        x += columns;
+    }
+}
+
+ValueField::ValueField(int x, int y, int width, long min, long max, long step)
+    : Widget(x, y, width, 1), _value(min), _min(min), _max(max), _step(step)
+{
+}
+
+void ValueField::setValue(long value)
+{
+    if (value < _min)
+        value = _min;
+    if (value > _max)
+        value = _max;
+    if (value == _value)
+        return;
+    _value = value;
+    invalidate();
+}
+
+bool ValueField::key(WidgetKey key)
+{
+    long old = _value;
+
+    if (key == WIDGET_KEY_UP)
+        setValue(_value + _step);
+    else if (key == WIDGET_KEY_DOWN)
+        setValue(_value - _step);
+    else
+        return false;
+    return _value != old;
+}
+
+void ValueField::draw(WidgetScreen &screen)
+{
+    char str[DISPLAY_WIDTH + 1];
+    int length;
+
+    length = snprintf(str, sizeof(str), "%*ld", _width, _value);
+    if (length > _width)
+    {
+        // does not fit
+        memset(str, '*', _width);
+        str[_width] = 0;
+    }
+    screen.text(_x, _y, str, _width);
+}
+
+Menu::Menu(int x, int y, int width, int rows, const char *const *items, int count)
+    : Widget(x, y, width, rows), _items(items), _count(count), _top(0), _selection(0), _activated(-1)
+{
+}
+
+void Menu::setSelection(int index)
+{
+    if (index >= _count)
+        index = _count - 1;
+    if (index < 0)
+        index = 0;
+    _selection = index;
+    // scroll the selection into view
+    if (index < _top)
+    {
+        _top = index;
+        invalidate();
+    }
+    else if (index >= _top + _height)
+    {
+        _top = index - _height + 1;
+        invalidate();
+    }
+}
+
+int Menu::activated()
+{
+    int index = _activated;
+
+    _activated = -1;
+    return index;
+}
+
+bool Menu::key(WidgetKey key)
+{
+    switch (key)
+    {
+    case WIDGET_KEY_UP:
+        if (_selection == 0)
+            return false;
+        setSelection(_selection - 1);
+        return true;
+    case WIDGET_KEY_DOWN:
+        if (_selection >= _count - 1)
+            return false;
+        setSelection(_selection + 1);
+        return true;
+    case WIDGET_KEY_ENTER:
+        _activated = _selection;
+        return true;
+    default:
+        return false;
+    }
+}
+
+void Menu::highlight(int *x, int *y, int *width)
+{
+    *x = _x;
+    *y = _y + _selection - _top;
+    *width = _width;
+}
+
+void Menu::draw(WidgetScreen &screen)
+{
+    int row;
+
+    for (row = 0; row < _height; row++)
+    {
+        screen.text(_x, _y + row, _top + row < _count ? _items[_top + row] : "", _width);
+    }
+}
+
+ProgressBar::ProgressBar(int x, int y, int width, long max)
+    : Widget(x, y, width, 1), _value(0), _max(max < 1 ? 1 : max)
+{
+}
+
+void ProgressBar::setValue(long value)
+{
+    if (value < 0)
+        value = 0;
+    if (value > _max)
+        value = _max;
+    // in pixels: the cells of the attribute mode change with them
+    if (scaled(value, _width * 8) != scaled(_value, _width * 8))
+        invalidate();
+    _value = value;
+}
+
+void ProgressBar::draw(WidgetScreen &screen)
+{
+    unsigned char row[DISPLAY_WIDTH];
+    int length, cells, line, i;
+
+    screen.text(_x, _y, "", _width);
+    if (screen.highlightMode() == HIGHLIGHT_INVERT)
+    {
+        cells = scaled(_value, _width);
+        screen.attributes(_x, _y, ATTR_REVERSE, cells);
+        screen.attributes(_x + cells, _y, ATTR_NORMAL, _width - cells);
+        return;
+    }
+
+    length = scaled(_value, _width * 8);
+    for (i = 0; i < _width; i++)
+    {
+        if (length >= (i + 1) * 8)
+            row[i] = 0xFF;
+        else if (length <= i * 8)
+            row[i] = 0x00;
+        else
+            row[i] = 0xFF << (8 - (length - i * 8));
+    }
+    // six pixel lines, blank above and below
+    for (line = 1; line < 7; line++)
+    {
+        screen.vram().write(VRAM_GRPH_ADDR + (_y * 8 + line) * DISPLAY_WIDTH + _x, row, _width);
+    }
+}
+
+WidgetScreen::WidgetScreen(T6963C &lcd, ShadowVram &vram, CgramAllocator *cgram, WidgetHighlight highlight)
+    : _lcd(lcd), _vram(vram), _cgram(cgram), _attributes(lcd, vram), _mode(highlight), _count(0), _focus(-1),
+      _hx(0), _hy(0), _hw(0)
+{
+    memset(&counters, 0, sizeof(counters));
+}
+
+bool WidgetScreen::add(Widget &widget)
+{
+    if (_count == WIDGET_MAX)
+        return false;
+    _widgets[_count++] = &widget;
+    return true;
+}
+
+void WidgetScreen::begin()
+{
+    int i;
+
+    if (_mode == HIGHLIGHT_INVERT)
+    {
+        _attributes.enable();
+    }
+    else
+    {
+        _lcd.commandSet(MODE_SET + MODE_OR + MODE_INT_CG);
+        _lcd.commandSet(CURSOR_BASE + 7);
+    }
+    _hw = 0;
+    _focus = -1;
+    for (i = 0; i < _count; i++)
+    {
+        _widgets[i]->invalidate();
+        if (_focus < 0 && _widgets[i]->focusable())
+            _focus = i;
+    }
+}
+
+bool WidgetScreen::key(WidgetKey key)
+{
+    int i, step;
+
+    if (_focus < 0)
+        return false;
+    if (_widgets[_focus]->key(key))
+        return true;
+
+    // keys the widget did not use move the focus
+    if (key == WIDGET_KEY_UP || key == WIDGET_KEY_LEFT)
+        step = _count - 1;
+    else if (key == WIDGET_KEY_DOWN || key == WIDGET_KEY_RIGHT || key == WIDGET_KEY_NEXT)
+        step = 1;
+    else
+        return false;
+    for (i = (_focus + step) % _count; i != _focus; i = (i + step) % _count)
+    {
+        if (_widgets[i]->focusable())
+        {
+            _focus = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void WidgetScreen::focus(Widget *widget)
+{
+    int i;
+
+    for (i = 0; i < _count; i++)
+    {
+        if (_widgets[i] == widget && widget->focusable())
+            _focus = i;
+    }
+}
+
+Widget *WidgetScreen::focused()
+{
+    return _focus >= 0 ? _widgets[_focus] : NULL;
+}
+
+void WidgetScreen::render()
+{
+    int i;
+
+    counters.renders++;
+    for (i = 0; i < _count; i++)
+    {
+        if (!_widgets[i]->dirty())
+        {
+            counters.skipped++;
+            continue;
+        }
+        _widgets[i]->draw(*this);
+        _widgets[i]->_dirty = false;
+        counters.redraws++;
+    }
+    moveHighlight();
+    _vram.flush();
+
+    if (_mode == HIGHLIGHT_CURSOR)
+    {
+        if (_hw > 0)
+            _lcd.dataWrite2Bytes(REG_CURSOR, _hx, _hy);
+        _lcd.commandSet(ENA_BASE + ENA_TEXTGRPH + (_hw > 0 ? ENA_CURSOR_BLINK : 0));
+    }
+    else
+    {
+        _lcd.commandSet(ENA_BASE + ENA_TEXTGRPH);
+    }
+}
+
+void WidgetScreen::moveHighlight()
+{
+    int x = 0, y = 0, width = 0;
+
+    if (_focus >= 0)
+        _widgets[_focus]->highlight(&x, &y, &width);
+    if (x == _hx && y == _hy && width == _hw)
+        return;
+
+    counters.highlights++;
+    if (_hw > 0)
+        attributes(_hx, _hy, ATTR_NORMAL, _hw);
+    if (width > 0)
+        attributes(x, y, ATTR_REVERSE, width);
+    _hx = x;
+    _hy = y;
+    _hw = width;
+}
+
+void WidgetScreen::text(int x, int y, const char *str, int width)
+{
+    unsigned char codes[DISPLAY_WIDTH];
+    int i;
+
+    if (x + width > DISPLAY_WIDTH)
+        width = DISPLAY_WIDTH - x;
+    for (i = 0; i < width; i++)
+    {
+        // character ROM codes are ASCII - 0x20
+        if (*str >= ' ' && *str < 0x7F)
+            codes[i] = *str++ - ' ';
+        else
+            codes[i] = 0;
+    }
+    _vram.write(VRAM_TEXT_ADDR + y * DISPLAY_WIDTH + x, codes, width);
+}
+
+void WidgetScreen::attributes(int x, int y, unsigned char attr, int width)
+{
+    if (_mode != HIGHLIGHT_INVERT || width <= 0)
+        return;
+    _attributes.set(x, y, attr, width);
+}
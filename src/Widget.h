@@ -0,0 +1,270 @@
+#ifndef WIDGET_H
+#define WIDGET_H
+
+#include <stdint.h>
+#include "T6963C.h"
+#include "LcdLayout.h"
+#include "ShadowVram.h"
+#include "CgramAllocator.h"
+#include "AttributePlane.h"
+
+#ifndef WIDGET_MAX
+#define WIDGET_MAX 16 // widgets per screen
+#endif
+#define WIDGET_TEXT_MAX 32 // bytes of a Label text, including the terminator
+
+/** Keys widgets understand; the application maps keypad keys to them */
+enum WidgetKey {
+    WIDGET_KEY_UP,
+    WIDGET_KEY_DOWN,
+    WIDGET_KEY_LEFT,
+    WIDGET_KEY_RIGHT,
+    WIDGET_KEY_ENTER,
+    WIDGET_KEY_NEXT, // next focusable widget
+};
+
+/** How the focused widget is shown */
+enum WidgetHighlight {
+    HIGHLIGHT_CURSOR, // blinking block cursor at the focused cell (REG_CURSOR)
+    HIGHLIGHT_INVERT, // reverse cells in text attribute mode (no graphics layer)
+};
+
+/** Counters of a WidgetScreen */
+struct WidgetCounters {
+    unsigned long renders;    // render() calls
+    unsigned long redraws;    // widgets drawn
+    unsigned long skipped;    // clean widgets not drawn
+    unsigned long highlights; // focus or selection moves
+};
+
+class WidgetScreen;
+
+/** Base of the retained widgets: a box of text cells and a dirty flag
+ *
+ *  Setters invalidate a widget only when what it shows changes;
+ *  WidgetScreen::render() draws the invalidated ones.
+ */
+class Widget {
+  public:
+    /** Create a widget
+     *
+     *  The box is clipped to the text page (empty if x, y is outside it).
+     *
+     *  @param x Text column
+     *  @param y Text row
+     *  @param width Columns
+     *  @param height Rows
+     */
+    Widget(int x, int y, int width, int height);
+    virtual ~Widget() {};
+
+    /** Draw the widget on the next render() */
+    void invalidate() { _dirty = true; }
+    bool dirty() { return _dirty; }
+
+    int x() { return _x; }
+    int y() { return _y; }
+    int width() { return _width; }
+    int height() { return _height; }
+
+    virtual bool focusable() { return false; }
+
+    /** Handle a key while focused
+     *
+     *  @return true if the key was used
+     */
+    virtual bool key(WidgetKey key);
+
+    /** Cells shown highlighted while focused (a run of width cells) */
+    virtual void highlight(int *x, int *y, int *width);
+
+  protected:
+    friend class WidgetScreen;
+
+    /** Draw into the screen's shadow (text, CGRAM or graphics) */
+    virtual void draw(WidgetScreen &screen) = 0;
+
+    int _x;
+    int _y;
+    int _width;
+    int _height;
+    bool _dirty;
+};
+
+/** Static or changing text
+ *
+ *  Height 1 draws ASCII with the character ROM. Height 2 draws UTF-8
+ *  through the screen's CgramAllocator: kanji two rows tall, ASCII from
+ *  the character ROM on the lower row.
+ */
+class Label : public Widget {
+  public:
+    Label(int x, int y, int width, const char *text = "", int height = 1);
+
+    /** Change the text; invalidates only if it differs */
+    void setText(const char *text);
+    const char *text() { return _text; }
+
+  protected:
+    virtual void draw(WidgetScreen &screen);
+
+  private:
+    char _text[WIDGET_TEXT_MAX];
+};
+
+/** Right aligned number, adjusted with UP / DOWN while focused */
+class ValueField : public Widget {
+  public:
+    ValueField(int x, int y, int width, long min, long max, long step = 1);
+
+    /** Set the value (clamped to [min, max]); invalidates only if it changes */
+    void setValue(long value);
+    long value() { return _value; }
+
+    virtual bool focusable() { return true; }
+    virtual bool key(WidgetKey key);
+
+  protected:
+    virtual void draw(WidgetScreen &screen);
+
+  private:
+    long _value;
+    long _min;
+    long _max;
+    long _step;
+};
+
+/** Scrolling list with a selection
+ *
+ *  Moving the selection within the visible rows only moves the highlight;
+ *  the text is redrawn when the list scrolls. ENTER activates the
+ *  selected item (see activated()).
+ */
+class Menu : public Widget {
+  public:
+    /** Create a menu
+     *
+     *  @param items ASCII item texts (kept by reference)
+     *  @param count Number of items
+     *  @param rows Visible rows
+     */
+    Menu(int x, int y, int width, int rows, const char *const *items, int count);
+
+    void setSelection(int index);
+    int selection() { return _selection; }
+
+    /** Item activated with ENTER since the last call, or -1 */
+    int activated();
+
+    virtual bool focusable() { return true; }
+    virtual bool key(WidgetKey key);
+    virtual void highlight(int *x, int *y, int *width);
+
+  protected:
+    virtual void draw(WidgetScreen &screen);
+
+  private:
+    const char *const *_items;
+    int _count;
+    int _top; // first visible item
+    int _selection;
+    int _activated;
+};
+
+/** Horizontal bar, one text row high
+ *
+ *  Drawn with pixel resolution in the graphics layer, or as reverse cells
+ *  in text attribute mode.
+ */
+class ProgressBar : public Widget {
+  public:
+    /** Create a bar showing 0 to max (at least 1) */
+    ProgressBar(int x, int y, int width, long max);
+
+    /** Set the value; invalidates only if the bar length changes */
+    void setValue(long value);
+    long value() { return _value; }
+
+  protected:
+    virtual void draw(WidgetScreen &screen);
+
+  private:
+    int scaled(long value, int units) { return (int)((int64_t)value * units / _max); } // 0 .. units
+    long _value;
+    long _max;
+};
+
+/** Retained widget tree on the text layer with incremental redraw
+ *
+ *  render() draws only the widgets invalidated since the last render into
+ *  the ShadowVram and flushes it, so only the bytes that changed reach the
+ *  display. Focus and menu selection are shown without redrawing text:
+ *  HIGHLIGHT_CURSOR moves the hardware cursor (one REG_CURSOR write),
+ *  HIGHLIGHT_INVERT rewrites the attribute bytes of the old and the new
+ *  highlight in an AttributePlane at VRAM_GRPH_ADDR, so there is no
+ *  graphics layer in that mode.
+ */
+class WidgetScreen {
+  public:
+    /** Create a screen
+     *
+     *  @param lcd Display the mode, cursor and enable commands go to
+     *  @param vram Shadow the widgets draw into
+     *  @param cgram Allocator for two-row labels (NULL if not used)
+     *  @param highlight How the focus is shown
+     */
+    WidgetScreen(T6963C &lcd, ShadowVram &vram, CgramAllocator *cgram = 0,
+                 WidgetHighlight highlight = HIGHLIGHT_CURSOR);
+    virtual ~WidgetScreen() {};
+
+    /** Add a widget (drawn in the order added)
+     *
+     *  @return false if the screen already has WIDGET_MAX widgets
+     */
+    bool add(Widget &widget);
+
+    /** Set the display mode, invalidate every widget and focus the first focusable one */
+    void begin();
+
+    /** Pass a key to the focused widget, or move the focus if it does not use it
+     *
+     *  @return true if the key changed anything
+     */
+    bool key(WidgetKey key);
+
+    void focus(Widget *widget);
+    Widget *focused();
+
+    /** Draw the invalidated widgets, move the highlight and flush */
+    void render();
+
+    /** Write ASCII text padded with blanks to width cells */
+    void text(int x, int y, const char *str, int width);
+
+    /** Set the attribute of width cells (HIGHLIGHT_INVERT only) */
+    void attributes(int x, int y, unsigned char attr, int width);
+
+    ShadowVram &vram() { return _vram; }
+    CgramAllocator *cgram() { return _cgram; }
+    WidgetHighlight highlightMode() { return _mode; }
+    AttributePlane &attributePlane() { return _attributes; }
+
+    WidgetCounters counters;
+
+  private:
+    void moveHighlight();
+
+    T6963C &_lcd;
+    ShadowVram &_vram;
+    CgramAllocator *_cgram;
+    AttributePlane _attributes;
+    WidgetHighlight _mode;
+    Widget *_widgets[WIDGET_MAX];
+    int _count;
+    int _focus; // index in _widgets, -1 = none
+    int _hx;    // highlight shown: cells [_hx, _hx + _hw) of row _hy
+    int _hy;
+    int _hw;    // 0 = none
+};
+
+#endif
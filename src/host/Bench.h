@@ -0,0 +1,17 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/** Host micro-benchmarks, selected by the first program argument
+ *
+ *  @return process exit code (non-zero if a self-check failed)
+ */
+int benchTranspose();
+int benchUtf8();
+int benchQueue();
+int benchDraw();
+int benchPort();
+int benchPanels();
+int benchMirror(const char *path);
+int benchLayout();
+
+#endif
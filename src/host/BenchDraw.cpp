@@ -0,0 +1,166 @@
+// Surface micro-benchmark: spans, rectangles, lines and blits on a
+// 240x128 packed surface, after checking them against pixel-by-pixel
+// reference drawing.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include "Bench.h"
+#include "../Surface.h"
+#include "../LcdLayout.h"
+
+#define DRAW_WIDTH (DISPLAY_WIDTH * 8)
+#define DRAW_HEIGHT (DISPLAY_HEIGHT * 8)
+
+static unsigned char fast[GRPH_PAGE_SIZE];
+static unsigned char slow[GRPH_PAGE_SIZE];
+static uint32_t seed = 1;
+
+static int nextRandom(int range)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) % range;
+}
+
+static void refRect(Surface &s, int x, int y, int w, int h, RasterOp op)
+{
+    int i, j;
+
+    for (j = y; j < y + h; j++)
+    {
+        for (i = x; i < x + w; i++)
+        {
+            s.pixel(i, j, op);
+        }
+    }
+}
+
+static void refBlit(Surface &s, int x, int y, const unsigned char *src, int w, int h, int stride, RasterOp op)
+{
+    bool bit, old;
+    int i, j;
+
+    for (j = 0; j < h; j++)
+    {
+        for (i = 0; i < w; i++)
+        {
+            if (x + i < 0 || y + j < 0 || x + i >= DRAW_WIDTH || y + j >= DRAW_HEIGHT)
+                continue;
+            bit = (src[j * stride + (i >> 3)] >> (7 - (i & 7))) & 1;
+            old = s.getPixel(x + i, y + j);
+            if ((op == ROP_OR && bit) || (op == ROP_XOR && bit && !old))
+                s.pixel(x + i, y + j, ROP_OR);
+            else if ((op == ROP_AND && !bit) || (op == ROP_CLEAR && bit) || (op == ROP_XOR && bit && old))
+                s.pixel(x + i, y + j, ROP_CLEAR);
+        }
+    }
+}
+
+static double nsPer(std::chrono::steady_clock::time_point t0, int count)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / count;
+}
+
+int benchDraw()
+{
+    Surface a(fast, DRAW_WIDTH, DRAW_HEIGHT, DISPLAY_WIDTH);
+    Surface b(slow, DRAW_WIDTH, DRAW_HEIGHT, DISPLAY_WIDTH);
+    unsigned char glyph[3 * 20];
+    const int rounds = 20000;
+    RasterOp op;
+    int i, x, y, w, h;
+
+    for (i = 0; i < (int)sizeof(glyph); i++)
+    {
+        glyph[i] = (unsigned char)nextRandom(256);
+    }
+
+    // random rectangles and blits (partly off the surface) in all modes
+    memset(fast, 0, sizeof(fast));
+    memset(slow, 0, sizeof(slow));
+    for (i = 0; i < 4000; i++)
+    {
+        op = (RasterOp)nextRandom(4);
+        x = nextRandom(DRAW_WIDTH + 40) - 20;
+        y = nextRandom(DRAW_HEIGHT + 40) - 20;
+        w = 1 + nextRandom(i & 1 ? 20 : 100);
+        h = 1 + nextRandom(20);
+        if (i & 1)
+        {
+            a.blit(x, y, glyph, w, h, 3, op);
+            refBlit(b, x, y, glyph, w, h, 3, op);
+        }
+        else
+        {
+            a.fillRect(x, y, w, h, op);
+            refRect(b, x, y, w, h, op);
+        }
+        if (memcmp(fast, slow, sizeof(fast)) != 0)
+        {
+            printf("draw: %s %d at (%d,%d) %dx%d op %d differs from the reference\n",
+                   i & 1 ? "blit" : "fillRect", i, x, y, w, h, op);
+            return 1;
+        }
+    }
+    // XOR lines twice leave the surface unchanged
+    for (i = 0; i < 1000; i++)
+    {
+        x = nextRandom(DRAW_WIDTH);
+        y = nextRandom(DRAW_HEIGHT);
+        w = nextRandom(DRAW_WIDTH);
+        h = nextRandom(DRAW_HEIGHT);
+        a.line(x, y, w, h, ROP_XOR);
+        a.line(x, y, w, h, ROP_XOR);
+    }
+    if (memcmp(fast, slow, sizeof(fast)) != 0)
+    {
+        printf("draw: XOR lines are not reversible\n");
+        return 1;
+    }
+    printf("draw: self-check passed\n");
+
+    printf("%-24s %12s\n", "operation", "ns");
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (i = 0; i < rounds; i++)
+    {
+        a.fill(i & 1 ? ROP_OR : ROP_CLEAR);
+    }
+    printf("%-24s %12.1f\n", "fill 240x128", nsPer(t0, rounds));
+
+    t0 = std::chrono::steady_clock::now();
+    for (i = 0; i < rounds; i++)
+    {
+        a.fill(ROP_XOR);
+    }
+    printf("%-24s %12.1f\n", "fill 240x128 XOR", nsPer(t0, rounds));
+
+    t0 = std::chrono::steady_clock::now();
+    for (i = 0; i < rounds; i++)
+    {
+        a.fillRect(3, 5, 229, 117, ROP_XOR);
+    }
+    printf("%-24s %12.1f\n", "fillRect 229x117 XOR", nsPer(t0, rounds));
+
+    t0 = std::chrono::steady_clock::now();
+    for (i = 0; i < rounds * 10; i++)
+    {
+        a.line(i % DRAW_WIDTH, 0, DRAW_WIDTH - 1 - i % DRAW_WIDTH, DRAW_HEIGHT - 1, ROP_XOR);
+    }
+    printf("%-24s %12.1f\n", "line (diagonal)", nsPer(t0, rounds * 10));
+
+    t0 = std::chrono::steady_clock::now();
+    for (i = 0; i < rounds * 10; i++)
+    {
+        a.blit((i * 8) % 224, (i * 16) % 112, glyph, 16, 16, 3, ROP_OR);
+    }
+    printf("%-24s %12.1f\n", "blit 16x16 aligned", nsPer(t0, rounds * 10));
+
+    t0 = std::chrono::steady_clock::now();
+    for (i = 0; i < rounds * 10; i++)
+    {
+        a.blit(i % 224, (i * 16) % 112, glyph, 16, 16, 3, ROP_XOR);
+    }
+    printf("%-24s %12.1f\n", "blit 16x16 unaligned", nsPer(t0, rounds * 10));
+    return 0;
+}
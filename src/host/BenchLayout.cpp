@@ -0,0 +1,162 @@
+// TextLayout self-check and cost: line breaking cases, glyph placement at
+// odd pixel positions against a pixel-by-pixel reference, then layout and
+// draw times with and without the layout cache.
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "Bench.h"
+#include "SimClock.h"
+#include "FontRomSim.h"
+#include "../TextLayout.h"
+#include "../LcdLayout.h"
+
+#define DRAW_WIDTH (DISPLAY_WIDTH * 8)
+#define DRAW_HEIGHT (DISPLAY_HEIGHT * 8)
+
+static unsigned char fast[GRPH_PAGE_SIZE];
+static unsigned char slow[GRPH_PAGE_SIZE];
+
+// One glyph pixel by pixel from the CGRAM cells (UL, UR, LL, LR)
+static void refGlyph(Surface &s, int x, int y, const unsigned char *cg, int width)
+{
+    int px, py;
+
+    for (py = 0; py < 16; py++)
+    {
+        for (px = 0; px < width; px++)
+        {
+            if ((cg[(py >> 3) * 16 + (px >> 3) * 8 + (py & 7)] >> (7 - (px & 7))) & 1)
+                s.pixel(x + px, y + py);
+        }
+    }
+}
+
+static void refDraw(Surface &s, GlyphCache &glyphs, int x, int y, const Layout *layout)
+{
+    const LayoutLine *line;
+    const unsigned char *cg;
+    int i, j, cx, width;
+
+    for (i = 0; i < layout->lineCount; i++)
+    {
+        line = &layout->lines[i];
+        for (j = line->first, cx = x; j < line->first + line->count; j++)
+        {
+            if (layout->codes[j] == '\n')
+                continue;
+            cg = glyphs.kuten(layout->codes[j], &width);
+            if (layout->codes[j] != ' ' && layout->codes[j] != 0x0101)
+                refGlyph(s, cx, y + i * LAYOUT_LINE_HEIGHT, cg, width);
+            cx += width;
+        }
+    }
+}
+
+static double nsPer(std::chrono::steady_clock::time_point t0, int count)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / count;
+}
+
+int benchLayout()
+{
+    static const struct
+    {
+        const char *utf8;
+        int maxWidth;
+        int counts[4]; // characters per line, 0 terminated
+    } cases[] = {
+        // 、 does not start a line: う goes along
+        {"\xE3\x81\x82\xE3\x81\x84\xE3\x81\x86\xE3\x80\x81", 48, {2, 2}},
+        // small kana does not start a line
+        {"\xE3\x81\x82\xE3\x81\x84\xE3\x82\x83", 32, {1, 2}},
+        // 「 does not end a line, 」 does not start one (forced when nothing else fits)
+        {"\xE3\x81\x82\xE3\x80\x8C\xE3\x81\x84\xE3\x80\x8D", 32, {1, 2, 1}},
+        // words break at spaces, which hang
+        {"hello world", 64, {6, 5}},
+        {"ab cd", 24, {3, 2}},
+        // mixed widths and a forced newline
+        {"Temp\n\xE6\xB8\xA9\xE5\xBA\xA6 25\xE2\x84\x83", 0, {5, 6}},
+        // a word wider than the line is cut
+        {"abcdefghij", 32, {4, 4, 2}},
+    };
+    static SimClock clock;
+    static FontRomSim rom(clock);
+    static GT20L16J1Y_FONT font(rom);
+    static GlyphCache glyphs(font);
+    static TextLayout text(glyphs);
+    const char *label = "Temp \xE6\xB8\xA9\xE5\xBA\xA6 25\xE2\x84\x83 \xE3\x81\x82\xE3\x81\x84\xE3\x81\x86"
+                        "\xE3\x80\x81\xE3\x80\x8Cok\xE3\x80\x8D";
+    Surface a(fast, DRAW_WIDTH, DRAW_HEIGHT, DISPLAY_WIDTH);
+    Surface b(slow, DRAW_WIDTH, DRAW_HEIGHT, DISPLAY_WIDTH);
+    const Layout *layout;
+    const int rounds = 20000;
+    unsigned int c;
+    int i, x;
+
+    for (c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+        layout = text.layout(cases[c].utf8, cases[c].maxWidth);
+        for (i = 0; i < 4 && cases[c].counts[i] != 0; i++)
+        {
+            if (i >= layout->lineCount || layout->lines[i].count != cases[c].counts[i])
+                break;
+        }
+        if ((i < 4 && cases[c].counts[i] != 0) || i != layout->lineCount)
+        {
+            printf("layout: case %u breaks into", c);
+            for (i = 0; i < layout->lineCount; i++)
+            {
+                printf(" %d", layout->lines[i].count);
+            }
+            printf("\n");
+            return 1;
+        }
+    }
+
+    // every pixel offset within a byte, wrapped and not
+    for (x = 0; x < 16; x++)
+    {
+        memset(fast, 0, sizeof(fast));
+        memset(slow, 0, sizeof(slow));
+        layout = text.draw(a, x, x - 4, label, x & 1 ? 0 : 100 + x);
+        refDraw(b, glyphs, x, x - 4, layout);
+        if (memcmp(fast, slow, sizeof(fast)) != 0)
+        {
+            printf("layout: label at x %d differs from the reference\n", x);
+            return 1;
+        }
+    }
+    if (TextLayout::measure(label) != layout->width || layout->lineCount != 1)
+    {
+        printf("layout: measure() %d, layout width %d\n", TextLayout::measure(label), layout->width);
+        return 1;
+    }
+    printf("layout: self-check passed\n");
+
+    printf("%-24s %12s\n", "operation", "ns");
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (i = 0; i < rounds; i++)
+    {
+        text.clear();
+        text.layout(label, 100);
+    }
+    printf("%-24s %12.1f\n", "layout (uncached)", nsPer(t0, rounds));
+
+    t0 = std::chrono::steady_clock::now();
+    for (i = 0; i < rounds; i++)
+    {
+        text.layout(label, 100);
+    }
+    printf("%-24s %12.1f\n", "layout (cached)", nsPer(t0, rounds));
+
+    t0 = std::chrono::steady_clock::now();
+    for (i = 0; i < rounds; i++)
+    {
+        text.draw(a, i & 7, 20, label, 100);
+    }
+    printf("%-24s %12.1f\n", "draw (wrapped label)", nsPer(t0, rounds));
+    printf("layout: %lu layouts, %lu hits, %lu glyphs, glyph cache %lu hits %lu misses\n", text.counters.layouts,
+           text.counters.hits, text.counters.glyphs, glyphs.counters.hits, glyphs.counters.misses);
+    return 0;
+}
@@ -0,0 +1,133 @@
+// VramMirror over a modelled 115200 baud UART: 3 s of text, graphics and
+// CGRAM updates, then the stream is written to a file for mirrorview.py.
+// The final shadow hash is printed so the viewer's rebuild can be compared.
+
+#include <stdio.h>
+#include <string.h>
+#include "Bench.h"
+#include "T6963CSim.h"
+#include "../VramMirror.h"
+#include "../Surface.h"
+
+#define MIRROR_BAUD 115200
+
+struct Uart {
+    FILE *file;
+    double budget; // bytes the modelled UART can take now
+};
+
+static int uartWrite(const void *data, int length, void *context)
+{
+    Uart *uart = (Uart *)context;
+    int n = length < (int)uart->budget ? length : (int)uart->budget;
+
+    if (n > 0)
+    {
+        fwrite(data, 1, n, uart->file);
+        uart->budget -= n;
+    }
+    return n;
+}
+
+static uint32_t hash(const unsigned char *data, int length)
+{
+    uint32_t h = 2166136261u;
+    int i;
+
+    for (i = 0; i < length; i++)
+    {
+        h = (h ^ data[i]) * 16777619u;
+    }
+    return h;
+}
+
+int benchMirror(const char *path)
+{
+    static SimClock clock;
+    static T6963CSim sim(clock);
+    static T6963C lcd(sim);
+    static ShadowVram vram(lcd);
+    Surface screen(vram.buffer(VRAM_GRPH_ADDR), DISPLAY_WIDTH * 8, DISPLAY_HEIGHT * 8, DISPLAY_WIDTH);
+    Uart uart;
+    char line[DISPLAY_WIDTH + 1];
+    unsigned char glyph[8];
+    uint32_t nowUs;
+    unsigned long keyBytes = 0, frames;
+    bool busy = false;
+    int i, length, x = 0;
+
+    uart.file = fopen(path, "wb");
+    if (uart.file == NULL)
+    {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    uart.budget = 0;
+
+    lcd.reset();
+    lcd.dataWrite2Bytes(DISP_TEXT_HOME_ADDR, VRAM_TEXT_ADDR & 0xFF, VRAM_TEXT_ADDR >> 8);
+    lcd.dataWrite2Bytes(DISP_TEXT_WIDTH, DISPLAY_WIDTH, 0);
+    lcd.dataWrite2Bytes(DISP_GRPH_HOME_ADDR, VRAM_GRPH_ADDR & 0xFF, VRAM_GRPH_ADDR >> 8);
+    lcd.dataWrite2Bytes(DISP_GRPH_WIDTH, DISPLAY_WIDTH, 0);
+    lcd.dataWrite2Bytes(REG_OFFSET, CGRAM_START >> 11, 0);
+    lcd.commandSet(MODE_SET + MODE_OR + MODE_INT_CG);
+    lcd.commandSet(ENA_BASE + ENA_TEXTGRPH);
+    lcd.memoryClear(VRAM_START, VRAM_END);
+
+    VramMirror mirror(vram, lcd, uartWrite, &uart);
+
+    // 1ms steps: the application changes the screen every 50ms
+    for (nowUs = 0; nowUs < 3000000; nowUs += 1000)
+    {
+        if (nowUs % 50000 == 0)
+        {
+            // character codes: a space becomes 0, so keep the length
+            length = snprintf(line, sizeof(line), "t=%7.2fs frame %-10lu", nowUs / 1e6, mirror.counters.frames);
+            if (length > DISPLAY_WIDTH)
+                length = DISPLAY_WIDTH;
+            for (i = 0; i < length; i++)
+            {
+                line[i] -= ' ';
+            }
+            vram.write(VRAM_TEXT_ADDR + DISPLAY_WIDTH, (unsigned char *)line, length);
+            screen.fillRect(x, 64, 8, 8, ROP_CLEAR);
+            x = (x + 4) % (DISPLAY_WIDTH * 8 - 8);
+            screen.fillRect(x, 64, 8, 8);
+            vram.markDirty(VRAM_GRPH_ADDR, GRPH_PAGE_SIZE);
+        }
+        if (nowUs % 1000000 == 0)
+        {
+            // a CGRAM glyph shown at the top left
+            for (i = 0; i < 8; i++)
+            {
+                glyph[i] = (unsigned char)((0x81 << (i + nowUs / 1000000)) | (0x81 >> i));
+            }
+            vram.write(CGRAM_START + CGRAM_STORE_OFFSET, glyph, 8);
+            glyph[0] = 0x80;
+            vram.write(VRAM_TEXT_ADDR, glyph, 1);
+        }
+        vram.flush();
+
+        uart.budget += MIRROR_BAUD / 10 / 1000.0;
+        frames = mirror.counters.frames;
+        busy = mirror.poll(nowUs);
+        if (frames == 0 && mirror.counters.frames == 1)
+            keyBytes = mirror.counters.bytes;
+    }
+    // until a frame started after the last change is out
+    frames = mirror.counters.frames + (busy ? 2 : 1);
+    while (busy || mirror.counters.frames < frames)
+    {
+        uart.budget += MIRROR_BAUD / 10 / 1000.0;
+        busy = mirror.poll(nowUs);
+        nowUs += 1000;
+    }
+    fclose(uart.file);
+
+    printf("mirror: %lu frames (%lu key), %lu bytes: first keyframe %lu, then %.1f per frame\n",
+           mirror.counters.frames, mirror.counters.keyframes, mirror.counters.bytes, keyBytes,
+           (double)(mirror.counters.bytes - keyBytes) / (mirror.counters.frames - 1));
+    printf("mirror: %lu stalls at %d baud, shadow hash %08x -> %s\n", mirror.counters.stalls, MIRROR_BAUD,
+           hash(vram.buffer(VRAM_START), SHADOW_SIZE), path);
+    return 0;
+}
@@ -0,0 +1,85 @@
+// PanelScheduler: the same text screen to one panel, mirrored to two
+// panels and different screens to two panels. The simulated controllers
+// share one SimClock, i.e. one bus: a cycle to one panel is time the
+// other spends busy.
+
+#include <stdio.h>
+#include <string.h>
+#include "Bench.h"
+#include "T6963CSim.h"
+#include "../T6963C.h"
+#include "../PanelScheduler.h"
+#include "../LcdLayout.h"
+
+static unsigned char rows[2][DISPLAY_HEIGHT][DISPLAY_WIDTH];
+
+// Clear the text area, then every row; 0: one panel, PANEL_ALL: mirrored, 2: one screen each
+static int screen(const char *name, int mode, double *bytesPerUs)
+{
+    SimClock clock;
+    T6963CSim sims[2] = {T6963CSim(clock), T6963CSim(clock)};
+    T6963C lcds[2] = {T6963C(sims[0]), T6963C(sims[1])};
+    PanelScheduler panels;
+    int panelCount = mode == 0 ? 1 : 2;
+    uint64_t start;
+    int i, y, bytes = 0;
+
+    for (i = 0; i < panelCount; i++)
+    {
+        panels.add(lcds[i], sims[i]);
+    }
+
+    // queued row by row, so a full queue runs both panels
+    start = clock.ns;
+    panels.fill(mode == 0 ? 0 : PANEL_ALL, VRAM_TEXT_ADDR, 0, TEXT_PAGE_SIZE);
+    for (y = 0; y < DISPLAY_HEIGHT; y++)
+    {
+        for (i = 0; i < panelCount; i++)
+        {
+            panels.write(mode == PANEL_ALL ? PANEL_ALL : i, VRAM_TEXT_ADDR + y * DISPLAY_WIDTH, rows[i][y],
+                         DISPLAY_WIDTH);
+            if (mode == PANEL_ALL)
+                break;
+        }
+    }
+    panels.run();
+    bytes = panelCount * 2 * TEXT_PAGE_SIZE;
+    *bytesPerUs = bytes * 1000.0 / (clock.ns - start);
+
+    for (i = 0; i < panelCount; i++)
+    {
+        if (memcmp(sims[i].vram + VRAM_TEXT_ADDR, rows[mode == PANEL_ALL ? 0 : i], TEXT_PAGE_SIZE) != 0 ||
+            sims[i].violations != 0)
+        {
+            fprintf(stderr, "%s: panel %d mismatch or %lu violations\n", name, i, sims[i].violations);
+            return 1;
+        }
+    }
+    printf("%-12s %d panel(s) %8.1f us %6.3f bytes/us, %lu polls (%lu busy) for %lu cycles\n", name, panelCount,
+           (clock.ns - start) / 1000.0, *bytesPerUs, panels.counters.polls, panels.counters.busy,
+           panels.counters.cycles);
+    return 0;
+}
+
+int benchPanels()
+{
+    double one, mirrored, independent;
+    int i, y, x;
+
+    for (i = 0; i < 2; i++)
+    {
+        for (y = 0; y < DISPLAY_HEIGHT; y++)
+        {
+            for (x = 0; x < DISPLAY_WIDTH; x++)
+            {
+                rows[i][y][x] = (unsigned char)(i * 64 + y * 3 + x + 1);
+            }
+        }
+    }
+
+    if (screen("single", 0, &one) != 0 || screen("mirrored", PANEL_ALL, &mirrored) != 0 ||
+        screen("independent", 2, &independent) != 0)
+        return 1;
+    printf("throughput vs. one panel: mirrored x%.2f, independent x%.2f\n", mirrored / one, independent / one);
+    return 0;
+}
@@ -0,0 +1,101 @@
+// PortLcdBus on the fake register file: drives the T6963C simulator
+// through the board's pin assignment and through a one-port assignment,
+// checks what arrives in VRAM and counts register accesses per bus cycle.
+
+#include <stdio.h>
+#include <string.h>
+#include "Bench.h"
+#include "FakeGpio.h"
+#include "T6963CSim.h"
+#include "../T6963C.h"
+
+// main.cpp: D2-D9 = PA10 PB3 PB5 PB4 PB10 PA8 PA9 PC7, D10-D14 = PB6 PA7 PA6 PA5 PB9
+struct BoardPins {
+    static const int DB0 = GPIO_PIN(0, 10), DB1 = GPIO_PIN(1, 3), DB2 = GPIO_PIN(1, 5), DB3 = GPIO_PIN(1, 4);
+    static const int DB4 = GPIO_PIN(1, 10), DB5 = GPIO_PIN(0, 8), DB6 = GPIO_PIN(0, 9), DB7 = GPIO_PIN(2, 7);
+    static const int WR = GPIO_PIN(1, 6), RD = GPIO_PIN(0, 7), CE = GPIO_PIN(0, 6), CD = GPIO_PIN(0, 5);
+    static const int RST = GPIO_PIN(1, 9);
+};
+
+// DB0-DB7 on PC0-PC7, strobes on PC8-PC12
+struct OnePortPins {
+    static const int DB0 = GPIO_PIN(2, 0), DB1 = GPIO_PIN(2, 1), DB2 = GPIO_PIN(2, 2), DB3 = GPIO_PIN(2, 3);
+    static const int DB4 = GPIO_PIN(2, 4), DB5 = GPIO_PIN(2, 5), DB6 = GPIO_PIN(2, 6), DB7 = GPIO_PIN(2, 7);
+    static const int WR = GPIO_PIN(2, 8), RD = GPIO_PIN(2, 9), CE = GPIO_PIN(2, 10), CD = GPIO_PIN(2, 11);
+    static const int RST = GPIO_PIN(2, 12);
+};
+
+static_assert(!PortBusMap<BoardPins>::consecutive(), "board data pins are scattered");
+static_assert(PortBusMap<OnePortPins>::consecutive(), "one-port data pins are consecutive");
+static_assert(PortBusMap<OnePortPins>::dataMask(2) == 0xFF, "DB0-DB7 on PC0-PC7");
+
+template <class Pins> static int run(const char *name)
+{
+    const int pins[13] = {Pins::DB0, Pins::DB1, Pins::DB2, Pins::DB3, Pins::DB4, Pins::DB5, Pins::DB6, Pins::DB7,
+                          Pins::WR, Pins::RD, Pins::CE, Pins::CD, Pins::RST};
+    SimClock clock;
+    T6963CSim sim(clock);
+    PortLcdBus<FakeGpio, Pins> bus;
+    T6963C lcd(bus);
+    unsigned char text[30], back[30];
+    unsigned long stores, loads;
+    int i;
+
+    FakeGpio::attach(&sim, &clock, pins);
+    lcd.reset();
+
+    lcd.memoryFill(0x0000, 0x0100, 0x55);
+    for (i = 0; i < 30; i++)
+    {
+        text[i] = (unsigned char)(i * 37 + 1);
+    }
+    lcd.dataWrite2Bytes(REG_ADDR, 0x00, 0x02);
+    lcd.autoDataWrite(text, 30);
+    lcd.dataWrite2Bytes(REG_ADDR, 0x00, 0x02);
+    lcd.autoDataRead(back, 30);
+    for (i = 0; i < 0x100; i++)
+    {
+        if (sim.vram[i] != 0x55)
+        {
+            fprintf(stderr, "%s: fill mismatch at 0x%04x\n", name, i);
+            return 1;
+        }
+    }
+    if (memcmp(sim.vram + 0x200, text, 30) != 0 || memcmp(back, text, 30) != 0)
+    {
+        fprintf(stderr, "%s: write/read back mismatch\n", name);
+        return 1;
+    }
+
+    // register accesses of single cycles
+    stores = FakeGpio::counters.stores;
+    for (i = 0; i < 100; i++)
+    {
+        bus.delay(1000);
+        bus.writeData(0);
+    }
+    stores = FakeGpio::counters.stores - stores;
+    loads = FakeGpio::counters.loads;
+    for (i = 0; i < 100; i++)
+    {
+        bus.readStatus();
+    }
+    loads = FakeGpio::counters.loads - loads;
+
+    printf("%-8s write cycle %.1f stores, status read %.1f loads (%s data pins)\n", name, stores / 100.0,
+           loads / 100.0, PortBusMap<Pins>::consecutive() ? "consecutive" : "scattered");
+    if (FakeGpio::counters.contention != 0 || sim.violations != 0)
+    {
+        fprintf(stderr, "%s: %lu contentions, %lu violations\n", name, FakeGpio::counters.contention,
+                sim.violations);
+        return 1;
+    }
+    return 0;
+}
+
+int benchPort()
+{
+    if (run<BoardPins>("board") != 0)
+        return 1;
+    return run<OnePortPins>("onePort");
+}
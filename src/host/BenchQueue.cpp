@@ -0,0 +1,112 @@
+// DisplayQueue stress test: one producer thread queues random writes, fills
+// and fences while HostDisplayQueue drains them into a simulator on its own
+// thread. The simulator VRAM must end up equal to a reference copy and
+// fences must pass in order.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include "Bench.h"
+#include "SimClock.h"
+#include "T6963CSim.h"
+#include "HostDisplayQueue.h"
+#include "../LcdLayout.h"
+
+static uint32_t seed = 12345;
+
+static uint32_t nextRandom(uint32_t range)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) % range;
+}
+
+int benchQueue()
+{
+    const int operations = 20000;
+    static SimClock clock;
+    static T6963CSim sim(clock);
+    static unsigned char model[VRAM_END];
+    T6963C lcd(sim);
+    HostDisplayQueue queue(lcd);
+    unsigned char data[100];
+    uint32_t tickets[8];
+    uint32_t last = 0;
+    int i, j, addr, length, pending = 0;
+
+    lcd.reset();
+    memset(model, 0, sizeof(model));
+    queue.start();
+
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (i = 0; i < operations; i++)
+    {
+        switch (nextRandom(4))
+        {
+        case 0:
+            length = 1 + nextRandom(600);
+            addr = nextRandom(VRAM_END - length);
+            queue.fill(addr, (unsigned char)i, length);
+            memset(model + addr, (unsigned char)i, length);
+            break;
+        default:
+            length = 1 + nextRandom(sizeof(data));
+            addr = nextRandom(VRAM_END - length);
+            for (j = 0; j < length; j++)
+            {
+                data[j] = (unsigned char)nextRandom(256);
+            }
+            queue.write(addr, data, length);
+            memcpy(model + addr, data, length);
+            break;
+        }
+
+        // a frame every 16 operations; now and then wait for an old one
+        if ((i & 15) == 15)
+        {
+            tickets[pending++] = queue.fence();
+            if (pending == 8)
+            {
+                queue.wait(tickets[0]);
+                for (j = 1; j < 8; j++)
+                {
+                    if (queue.done(tickets[j]) && !queue.done(tickets[j - 1]))
+                    {
+                        printf("queue: fence %u passed before %u\n", tickets[j], tickets[j - 1]);
+                        return 1;
+                    }
+                }
+                last = tickets[0];
+                memmove(tickets, tickets + 1, sizeof(tickets[0]) * 7);
+                pending = 7;
+            }
+        }
+    }
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    queue.flush();
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+    queue.stop();
+
+    if (!queue.done(last) || memcmp(sim.vram, model, sizeof(model)) != 0)
+    {
+        printf("queue: VRAM differs from the reference\n");
+        return 1;
+    }
+    if (sim.violations != 0)
+    {
+        printf("queue: bus protocol violations: %lu\n", sim.violations);
+        return 1;
+    }
+    printf("queue: self-check passed\n");
+
+    double produce = std::chrono::duration<double>(t1 - t0).count();
+    double flush = std::chrono::duration<double>(t2 - t1).count();
+    printf("  %lu commands, %lu fences, %lu run in %lu wakeups\n", queue.counters.commands,
+           queue.counters.fences, queue.counters.run, queue.counters.wakeups);
+    printf("  max depth %u/%d, %lu stalls, %lu blocking waits\n", queue.counters.maxDepth,
+           DISPLAY_QUEUE_SIZE, queue.counters.stalls, queue.counters.waits);
+    printf("  producer %.1f ms (%.2f us/operation), final flush %.1f ms\n", produce * 1e3,
+           produce * 1e6 / operations, flush * 1e3);
+    printf("  modelled bus time %.1f ms\n", clock.ns / 1e6);
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <string.h>
+#include "BenchReport.h"
+
+#define CSV_HEADER "scenario,status,command,dataWr,dataRd,romTrans,romBytes,bus_us"
+
+static unsigned long transactions(const ScenarioResult &r)
+{
+    return r.statusReads + r.commandWrites + r.dataWrites + r.dataReads + r.romTransactions;
+}
+
+static double change(double now, double base)
+{
+    if (base == 0)
+        return now == 0 ? 0 : 100;
+    return (now - base) * 100 / base;
+}
+
+void BenchReport::add(const ScenarioResult &result)
+{
+    if (count < BENCH_MAX_SCENARIOS)
+        results[count++] = result;
+}
+
+bool BenchReport::writeCsv(const char *path, bool cpu)
+{
+    FILE *f = fopen(path, "w");
+    int i;
+
+    if (f == NULL)
+        return false;
+    fprintf(f, "%s%s\n", CSV_HEADER, cpu ? ",cpu_us" : "");
+    for (i = 0; i < count; i++)
+    {
+        const ScenarioResult &r = results[i];
+
+        fprintf(f, "%s,%lu,%lu,%lu,%lu,%lu,%lu,%.1f", r.name, r.statusReads, r.commandWrites, r.dataWrites,
+                r.dataReads, r.romTransactions, r.romBytes, r.busUs);
+        if (cpu)
+            fprintf(f, ",%.1f", r.cpuUs);
+        fprintf(f, "\n");
+    }
+    return fclose(f) == 0;
+}
+
+int BenchReport::compare(const char *path, double threshold, double cpuThreshold)
+{
+    FILE *f = fopen(path, "r");
+    ScenarioResult base;
+    bool seen[BENCH_MAX_SCENARIOS];
+    char line[256];
+    double bus, trans, cpu;
+    int i, fields, regressions = 0;
+
+    if (f == NULL)
+        return -1;
+    memset(seen, 0, sizeof(seen));
+
+    printf("\n%-16s %12s %12s %8s %8s %8s  (threshold %.1f%%)\n", "vs. baseline", "bus[us]", "base[us]",
+           "bus", "trans", "cpu", threshold);
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        fields = sscanf(line, "%23[^,],%lu,%lu,%lu,%lu,%lu,%lu,%lf,%lf", base.name, &base.statusReads,
+                        &base.commandWrites, &base.dataWrites, &base.dataReads, &base.romTransactions,
+                        &base.romBytes, &base.busUs, &base.cpuUs);
+        if (fields < 8)
+            continue; // header
+        if (fields == 8)
+            base.cpuUs = -1; // written without CPU time
+        for (i = 0; i < count && strcmp(results[i].name, base.name) != 0; i++)
+        {
+        }
+        if (i == count)
+        {
+            printf("%-16s %12s\n", base.name, "missing");
+            continue;
+        }
+        seen[i] = true;
+
+        const ScenarioResult &r = results[i];
+        bus = change(r.busUs, base.busUs);
+        trans = change(transactions(r), transactions(base));
+        cpu = base.cpuUs < 0 ? 0 : change(r.cpuUs, base.cpuUs);
+        bool slower = bus > threshold || trans > threshold ||
+                      (base.cpuUs >= 0 && cpuThreshold > 0 && cpu > cpuThreshold);
+        if (base.cpuUs < 0)
+            printf("%-16s %12.1f %12.1f %+7.1f%% %+7.1f%% %8s%s\n", r.name, r.busUs, base.busUs, bus, trans,
+                   "-", slower ? "  REGRESSION" : "");
+        else
+            printf("%-16s %12.1f %12.1f %+7.1f%% %+7.1f%% %+7.1f%%%s\n", r.name, r.busUs, base.busUs, bus,
+                   trans, cpu, slower ? "  REGRESSION" : "");
+        if (slower)
+            regressions++;
+    }
+    fclose(f);
+
+    for (i = 0; i < count; i++)
+    {
+        if (!seen[i])
+            printf("%-16s %12.1f %12s\n", results[i].name, results[i].busUs, "new");
+    }
+    return regressions;
+}
@@ -0,0 +1,57 @@
+#ifndef BENCH_REPORT_H
+#define BENCH_REPORT_H
+
+#define BENCH_MAX_SCENARIOS 64
+
+/** Cost of one host scenario */
+struct ScenarioResult {
+    char name[24];
+    unsigned long statusReads;
+    unsigned long commandWrites;
+    unsigned long dataWrites;
+    unsigned long dataReads;
+    unsigned long romTransactions;
+    unsigned long romBytes;
+    double busUs; // modelled bus time
+    double cpuUs; // host CPU time
+};
+
+/** Scenario results as CSV, compared against a stored baseline
+ *
+ *  The CSV has a header line and one line per scenario:
+ *  scenario,status,command,dataWr,dataRd,romTrans,romBytes,bus_us[,cpu_us]
+ *  The host CPU time changes from run to run, so the committed baseline
+ *  is written without it and holds only the simulator's deterministic
+ *  numbers.
+ */
+class BenchReport {
+  public:
+    BenchReport() : count(0) {};
+
+    void add(const ScenarioResult &result);
+
+    /** Write all results
+     *
+     *  @param path CSV file
+     *  @param cpu false to leave out the cpu_us column
+     *  @return false if the file cannot be written
+     */
+    bool writeCsv(const char *path, bool cpu = true);
+
+    /** Compare with a baseline CSV written by writeCsv()
+     *
+     *  A scenario regresses when its modelled bus time or its number of
+     *  bus transactions (LCD + ROM) grew by more than threshold percent,
+     *  or, if cpuThreshold > 0 and the baseline has a cpu_us column, its
+     *  host CPU time by more than that.
+     *  Scenarios missing on either side are listed but do not fail.
+     *
+     *  @return Number of regressions, -1 if the baseline cannot be read
+     */
+    int compare(const char *path, double threshold, double cpuThreshold);
+
+    int count;
+    ScenarioResult results[BENCH_MAX_SCENARIOS];
+};
+
+#endif
@@ -0,0 +1,137 @@
+// transposeCg micro-benchmark: the original BitConverter kernel against the
+// word-parallel one, after checking that both give identical cells.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include "Bench.h"
+#include "../KanjiText.h"
+
+union BitConverter {
+    unsigned char ucData;
+    struct
+    {
+        unsigned char bit0 : 1;
+        unsigned char bit1 : 1;
+        unsigned char bit2 : 1;
+        unsigned char bit3 : 1;
+        unsigned char bit4 : 1;
+        unsigned char bit5 : 1;
+        unsigned char bit6 : 1;
+        unsigned char bit7 : 1;
+    } tBit;
+};
+
+// read2BytesCg before the word-parallel kernel
+static void transposeCgBitwise(const unsigned char *bitmap, unsigned char *cgData)
+{
+    union BitConverter bc;
+    int i, j;
+
+    for (i = 0; i < 32; i++)
+    {
+        cgData[i] = 0;
+    }
+
+    for (i = 0; i < 4; i++)
+    {
+        for (j = 0; j < 8; j++)
+        {
+            bc.ucData = bitmap[i * 8 + (7 - j)];
+            cgData[i * 8 + 0] += bc.tBit.bit0 << j;
+            cgData[i * 8 + 1] += bc.tBit.bit1 << j;
+            cgData[i * 8 + 2] += bc.tBit.bit2 << j;
+            cgData[i * 8 + 3] += bc.tBit.bit3 << j;
+            cgData[i * 8 + 4] += bc.tBit.bit4 << j;
+            cgData[i * 8 + 5] += bc.tBit.bit5 << j;
+            cgData[i * 8 + 6] += bc.tBit.bit6 << j;
+            cgData[i * 8 + 7] += bc.tBit.bit7 << j;
+        }
+    }
+}
+
+static bool same(const unsigned char *bitmap)
+{
+    unsigned char expect[32], actual[32];
+
+    transposeCgBitwise(bitmap, expect);
+    memset(actual, 0xA5, sizeof(actual)); // the kernel must not rely on a zeroed buffer
+    transposeCg(bitmap, actual);
+    return memcmp(expect, actual, 32) == 0;
+}
+
+static uint32_t lcg(uint32_t &state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+int benchTranspose()
+{
+    const int rounds = 200000;
+    unsigned char bitmaps[64][32];
+    unsigned char cgData[32];
+    unsigned int sink = 0;
+    uint32_t seed = 1;
+    int i, j, v, n;
+
+    // The transpose is linear over GF(2), so matching on every single-byte
+    // value at every position covers all 8x8 patterns; random full glyphs on top
+    for (i = 0; i < 32; i++)
+    {
+        for (v = 0; v < 256; v++)
+        {
+            memset(bitmaps[0], 0, 32);
+            bitmaps[0][i] = v;
+            if (!same(bitmaps[0]))
+            {
+                printf("transpose mismatch: byte %d = 0x%02x\n", i, v);
+                return 1;
+            }
+        }
+    }
+    for (n = 0; n < 100000; n++)
+    {
+        for (i = 0; i < 32; i++)
+        {
+            bitmaps[0][i] = lcg(seed) >> 24;
+        }
+        if (!same(bitmaps[0]))
+        {
+            printf("transpose mismatch on random glyph %d\n", n);
+            return 1;
+        }
+    }
+    printf("transpose: bit-exact\n");
+
+    for (i = 0; i < 64; i++)
+    {
+        for (j = 0; j < 32; j++)
+        {
+            bitmaps[i][j] = lcg(seed) >> 24;
+        }
+    }
+
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (n = 0; n < rounds; n++)
+    {
+        transposeCgBitwise(bitmaps[n & 63], cgData);
+        sink += cgData[n & 31];
+    }
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    for (n = 0; n < rounds; n++)
+    {
+        transposeCg(bitmaps[n & 63], cgData);
+        sink += cgData[n & 31];
+    }
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+    double bitwise = std::chrono::duration<double, std::nano>(t1 - t0).count() / rounds;
+    double word = std::chrono::duration<double, std::nano>(t2 - t1).count() / rounds;
+    printf("%-16s %10s\n", "kernel", "ns/glyph");
+    printf("%-16s %10.1f\n", "bitwise", bitwise);
+    printf("%-16s %10.1f\n", "word-parallel", word);
+    printf("speedup %.1fx (%u)\n", bitwise / word, sink & 1);
+    return 0;
+}
@@ -0,0 +1,151 @@
+// UTF-8 -> Ku-Ten decoder self-check and throughput over a mixed corpus.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "Bench.h"
+#include "../Utf8Kuten.h"
+
+static int encode(uint32_t cp, char *out)
+{
+    if (cp < 0x80)
+    {
+        out[0] = cp;
+        return 1;
+    }
+    if (cp < 0x800)
+    {
+        out[0] = 0xC0 | (cp >> 6);
+        out[1] = 0x80 | (cp & 0x3F);
+        return 2;
+    }
+    out[0] = 0xE0 | (cp >> 12);
+    out[1] = 0x80 | ((cp >> 6) & 0x3F);
+    out[2] = 0x80 | (cp & 0x3F);
+    return 3;
+}
+
+static bool check(const char *utf8, const unsigned short *expect, int count)
+{
+    unsigned short kuten[2];
+    const char *p;
+    Utf8Decoder decoder;
+    int i, n;
+
+    for (i = 0, p = utf8; i < count; i++)
+    {
+        p = utf8NextKuten(p, &kuten[0]);
+        if (kuten[0] != expect[i])
+            return false;
+    }
+    for (i = 0, p = utf8; *p; p++)
+    {
+        n = decoder.put(*p, kuten);
+        if (n > 0 && (i >= count || kuten[0] != expect[i++]))
+            return false;
+        if (n > 1 && (i >= count || kuten[1] != expect[i++]))
+            return false;
+    }
+    return i == count;
+}
+
+int benchUtf8()
+{
+    static const struct
+    {
+        const char *utf8;
+        unsigned short expect[4];
+        int count;
+    } cases[] = {
+        {"A", {0x0041}, 1},
+        {"\xE3\x81\x82", {0x0402}, 1},              // HIRAGANA A
+        {"\xE4\xBA\x9C", {0x1001}, 1},              // U+4E9C, first level 1 kanji
+        {"\xE3\x81" "A", {KUTEN_REPLACEMENT, 0x0041}, 2}, // cut short
+        {"\xC0\xA0", {KUTEN_REPLACEMENT}, 1},        // overlong
+        {"\xED\xA0\x80", {KUTEN_REPLACEMENT}, 1},    // surrogate
+        {"\xF0\x9F\x98\x80", {KUTEN_REPLACEMENT}, 1}, // outside the BMP
+    };
+    const int corpusBytes = 8 << 20;
+    std::vector<char> corpus;
+    char utf8[8];
+    unsigned short expect[1];
+    uint32_t cp, seed = 1, sink = 0;
+    unsigned short kuten[2];
+    unsigned long chars;
+    unsigned int i;
+    int n;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        if (!check(cases[i].utf8, cases[i].expect, cases[i].count))
+        {
+            printf("utf8: case %u failed\n", i);
+            return 1;
+        }
+    }
+    // both decoders agree with the table for every BMP code point
+    for (cp = 1; cp < 0x10000; cp++)
+    {
+        if (cp >= 0xD800 && cp <= 0xDFFF)
+            continue;
+        n = encode(cp, utf8);
+        utf8[n] = 0;
+        expect[0] = cp < 0x20 || cp == 0x7F ? KUTEN_REPLACEMENT : unicodeToKuten(cp);
+        if (!check(utf8, expect, 1))
+        {
+            printf("utf8: U+%04X failed\n", (unsigned int)cp);
+            return 1;
+        }
+    }
+    printf("utf8: self-check passed\n");
+
+    // ASCII words, kana and kanji in roughly UI proportions
+    corpus.reserve(corpusBytes + 8);
+    while ((int)corpus.size() < corpusBytes)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        switch (seed >> 30)
+        {
+        case 0:
+        case 1:
+            cp = 0x20 + (seed >> 8) % 0x5F;
+            break;
+        case 2:
+            cp = 0x3041 + (seed >> 8) % 0x53;
+            break;
+        default:
+            cp = 0x4E00 + (seed >> 8) % 0x5000;
+            break;
+        }
+        n = encode(cp, utf8);
+        corpus.insert(corpus.end(), utf8, utf8 + n);
+    }
+    corpus.push_back(0);
+
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    const char *p = &corpus[0];
+    for (chars = 0; *p; chars++)
+    {
+        p = utf8NextKuten(p, &kuten[0]);
+        sink += kuten[0];
+    }
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    Utf8Decoder decoder;
+    for (p = &corpus[0]; *p; p++)
+    {
+        n = decoder.put(*p, kuten);
+        if (n > 0)
+            sink += kuten[0];
+    }
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+    double string = std::chrono::duration<double>(t1 - t0).count();
+    double stream = std::chrono::duration<double>(t2 - t1).count();
+    printf("%-16s %10s %10s\n", "decoder", "MB/s", "Mchar/s");
+    printf("%-16s %10.1f %10.1f\n", "utf8NextKuten", corpusBytes / string / 1e6, chars / string / 1e6);
+    printf("%-16s %10.1f %10.1f\n", "Utf8Decoder", corpusBytes / stream / 1e6, chars / stream / 1e6);
+    printf("(%lu chars, %u)\n", chars, sink & 1);
+    return 0;
+}
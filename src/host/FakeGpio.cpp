@@ -0,0 +1,120 @@
+#include <string.h>
+#include "FakeGpio.h"
+
+enum { PIN_WR = 8, PIN_RD, PIN_CE, PIN_CD, PIN_RST };
+
+FakeGpioPort FakeGpio::ports[LCD_GPIO_PORTS];
+FakeGpioCounters FakeGpio::counters;
+
+static LcdBus *target;
+static SimClock *targetClock;
+static int busPins[13];
+
+static bool level(const FakeGpioPort *regs, int pin)
+{
+    return (regs[pin >> 4].ODR >> (pin & 15)) & 1;
+}
+
+// All data pins in output mode (1) or input mode (0)
+static bool dataMode(int mode)
+{
+    int n, pin;
+
+    for (n = 0; n < 8; n++)
+    {
+        pin = busPins[n];
+        if (((FakeGpio::ports[pin >> 4].MODER >> 2 * (pin & 15)) & 3) != (uint32_t)mode)
+            return false;
+    }
+    return true;
+}
+
+void FakeGpio::attach(LcdBus *bus, SimClock *simClock, const int pins[13])
+{
+    target = bus;
+    targetClock = simClock;
+    memcpy(busPins, pins, sizeof(busPins));
+    memset(&counters, 0, sizeof(counters));
+}
+
+void FakeGpio::output(int pin)
+{
+    ports[pin >> 4].MODER = (ports[pin >> 4].MODER & ~(3u << 2 * (pin & 15))) | 1u << 2 * (pin & 15);
+}
+
+void FakeGpio::bsrr(int port, uint32_t value)
+{
+    FakeGpioPort before[LCD_GPIO_PORTS];
+    unsigned char data = 0;
+    int n;
+
+    counters.stores++;
+    memcpy(before, ports, sizeof(before));
+    ports[port].ODR = (ports[port].ODR & ~(value >> 16)) | (value & 0xFFFF);
+    if (target == NULL)
+        return;
+    if (!level(before, busPins[PIN_RST]))
+    {
+        // held in reset: no bus cycles
+        if (level(ports, busPins[PIN_RST]))
+            target->reset();
+        return;
+    }
+
+    // ~WR rising (or ~CE rising during a write): latch the data pins
+    if (!level(before, busPins[PIN_CE]) && !level(before, busPins[PIN_WR]) &&
+        (level(ports, busPins[PIN_CE]) || level(ports, busPins[PIN_WR])))
+    {
+        if (!dataMode(1))
+            counters.contention++;
+        for (n = 0; n < 8; n++)
+        {
+            if (level(before, busPins[n]))
+                data |= 1 << n;
+        }
+        if (level(before, busPins[PIN_CD]))
+            target->writeCommand(data);
+        else
+            target->writeData(data);
+    }
+
+    // ~RD falling with ~CE low: the controller drives the data pins
+    if (!(!level(before, busPins[PIN_CE]) && !level(before, busPins[PIN_RD])) &&
+        !level(ports, busPins[PIN_CE]) && !level(ports, busPins[PIN_RD]))
+    {
+        if (!dataMode(0))
+            counters.contention++;
+        data = level(ports, busPins[PIN_CD]) ? target->readStatus() : target->readData();
+        for (n = 0; n < 8; n++)
+        {
+            FakeGpioPort &regs = ports[busPins[n] >> 4];
+            uint32_t bit = 1u << (busPins[n] & 15);
+
+            regs.IDR = (data >> n) & 1 ? regs.IDR | bit : regs.IDR & ~bit;
+        }
+    }
+}
+
+void FakeGpio::moder(int port, uint32_t mask, uint32_t value)
+{
+    counters.loads++;
+    counters.stores++;
+    ports[port].MODER = (ports[port].MODER & ~mask) | value;
+}
+
+uint32_t FakeGpio::idr(int port)
+{
+    counters.loads++;
+    return ports[port].IDR;
+}
+
+void FakeGpio::wait(unsigned int ns)
+{
+    if (targetClock != NULL)
+        targetClock->advance(ns);
+}
+
+void FakeGpio::sleep(int ms)
+{
+    wait(ms * 1000000u);
+}
@@ -0,0 +1,51 @@
+#ifndef FAKE_GPIO_H
+#define FAKE_GPIO_H
+
+#include <stdint.h>
+#include "SimClock.h"
+#include "../LcdBus.h"
+#include "../PortLcdBus.h"
+
+/** Registers of one fake GPIO port */
+struct FakeGpioPort {
+    uint32_t MODER;
+    uint32_t IDR;
+    uint32_t ODR;
+};
+
+/** Register accesses made through FakeGpio */
+struct FakeGpioCounters {
+    unsigned long stores;     // BSRR writes and MODER read-modify-writes
+    unsigned long loads;      // IDR reads and MODER read-modify-writes
+    unsigned long contention; // strobes while the data pins drive the wrong way
+};
+
+/** Host register file for PortLcdBus
+ *
+ *  BSRR stores update ODR. A decoder watches the pins of the attached bus
+ *  and turns strobe edges into cycles of an LcdBus (normally T6963CSim):
+ *  ~WR rising with ~CE low writes ODR's data bits, ~RD falling with ~CE
+ *  low reads a byte into IDR, ~RESET rising resets the target (no cycles
+ *  while it is low). Waits advance the simulator clock.
+ */
+struct FakeGpio {
+    /** Connect the pins to a simulated controller
+     *
+     *  @param target Bus cycles are forwarded here
+     *  @param clock Advanced by wait()
+     *  @param pins DB0-DB7, WR, RD, CE, CD, RST in the GPIO_PIN() encoding
+     */
+    static void attach(LcdBus *target, SimClock *clock, const int pins[13]);
+
+    static void output(int pin);
+    static void bsrr(int port, uint32_t value);
+    static void moder(int port, uint32_t mask, uint32_t value);
+    static uint32_t idr(int port);
+    static void wait(unsigned int ns);
+    static void sleep(int ms);
+
+    static FakeGpioPort ports[LCD_GPIO_PORTS];
+    static FakeGpioCounters counters;
+};
+
+#endif
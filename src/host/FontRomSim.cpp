@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <string.h>
+#include "FontRomSim.h"
+
+FontRomSim::FontRomSim(SimClock &clock) : _clock(clock), _readyAt(0)
+{
+    timing.transactionNs = 500;
+    timing.byteNs = 800;
+    _rom = new unsigned char[ROM_SIZE];
+    for (uint32_t i = 0; i < ROM_SIZE; i++)
+    {
+        _rom[i] = (unsigned char)((i * 2654435761u) >> 24);
+    }
+}
+
+FontRomSim::~FontRomSim()
+{
+    delete[] _rom;
+}
+
+bool FontRomSim::load(const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    size_t n;
+
+    if (fp == NULL)
+        return false;
+    n = fread(_rom, 1, ROM_SIZE, fp);
+    fclose(fp);
+    if (n < ROM_SIZE)
+        memset(_rom + n, 0xFF, ROM_SIZE - n);
+    return n > 0;
+}
+
+uint64_t FontRomSim::cost(int length)
+{
+    return timing.transactionNs + (4 + length) * timing.byteNs;
+}
+
+bool FontRomSim::busy()
+{
+    return _clock.ns < _readyAt;
+}
+
+void FontRomSim::waitIdle()
+{
+    if (busy())
+        _clock.advance(_readyAt - _clock.ns);
+}
+
+void FontRomSim::doStartRead(uint32_t address, unsigned char *data, int length)
+{
+    waitIdle();
+    _readyAt = _clock.ns + cost(length);
+    for (int i = 0; i < length; i++)
+    {
+        data[i] = _rom[(address + i) % ROM_SIZE];
+    }
+}
+
+void FontRomSim::doRead(uint32_t address, unsigned char *data, int length)
+{
+    waitIdle();
+    _clock.advance(cost(length));
+    for (int i = 0; i < length; i++)
+    {
+        data[i] = _rom[(address + i) % ROM_SIZE];
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef FONT_ROM_SIM_H
+#define FONT_ROM_SIM_H
+
+#include "SimClock.h"
+#include "../FontRomPort.h"
+
+/** SPI timing of the simulated font ROM in ns */
+struct FontRomTiming {
+    unsigned int transactionNs; // CS assert/deassert overhead
+    unsigned int byteNs;        // one byte on the wire (8 clocks at 10MHz)
+};
+
+/** Host stand-in for the GT20L16J1Y font ROM
+ *
+ *  Serves reads from a binary dump of the ROM. Without a dump every byte
+ *  is derived from its address, so glyph data is still deterministic.
+ *  startRead() models a DMA transfer: it completes at a future clock time
+ *  and only waitIdle() (or a blocking read) advances the clock to it.
+ */
+class FontRomSim : public FontRomPort {
+  public:
+    static const uint32_t ROM_SIZE = 0x40000;
+
+    FontRomSim(SimClock &clock);
+    virtual ~FontRomSim();
+
+    /** Load a ROM dump
+     *
+     *  @param path Binary dump file
+     *  @return true on success
+     */
+    bool load(const char *path);
+
+    virtual bool busy();
+    virtual void waitIdle();
+
+    FontRomTiming timing;
+
+  protected:
+    virtual void doRead(uint32_t address, unsigned char *data, int length);
+    virtual void doStartRead(uint32_t address, unsigned char *data, int length);
+
+  private:
+    uint64_t cost(int length);
+
+    SimClock &_clock;
+    uint64_t _readyAt;
+    unsigned char *_rom;
+};
+
+#endif
@@ -0,0 +1,68 @@
+#include <chrono>
+#include "HostDisplayQueue.h"
+
+HostDisplayQueue::HostDisplayQueue(T6963C &lcd) : DisplayQueue(lcd), _pending(false), _stop(false)
+{
+}
+
+HostDisplayQueue::~HostDisplayQueue()
+{
+    stop();
+}
+
+void HostDisplayQueue::start()
+{
+    _stop = false;
+    _thread = std::thread(&HostDisplayQueue::worker, this);
+}
+
+void HostDisplayQueue::stop()
+{
+    if (!_thread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stop = true;
+        _pending = true;
+    }
+    _work.notify_one();
+    _thread.join();
+}
+
+void HostDisplayQueue::worker()
+{
+    bool stop;
+
+    do
+    {
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            _work.wait(guard, [this] { return _pending; });
+            _pending = false;
+            stop = _stop;
+        }
+        drain();
+    } while (!stop);
+}
+
+void HostDisplayQueue::wakeWorker()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_pending)
+            return;
+        _pending = true;
+    }
+    _work.notify_one();
+}
+
+void HostDisplayQueue::waitProgress()
+{
+    std::unique_lock<std::mutex> guard(_lock);
+    _progress.wait_for(guard, std::chrono::milliseconds(1));
+}
+
+void HostDisplayQueue::signalProgress()
+{
+    _progress.notify_all();
+}
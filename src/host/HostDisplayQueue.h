@@ -0,0 +1,37 @@
+#ifndef HOST_DISPLAY_QUEUE_H
+#define HOST_DISPLAY_QUEUE_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "../DisplayQueue.h"
+
+/** DisplayQueue drained by a std::thread (host build) */
+class HostDisplayQueue : public DisplayQueue {
+  public:
+    HostDisplayQueue(T6963C &lcd);
+    virtual ~HostDisplayQueue();
+
+    /** Start the display thread; the T6963C belongs to it until stop() */
+    void start();
+
+    /** Drain the queue and join the thread */
+    void stop();
+
+  protected:
+    virtual void wakeWorker();
+    virtual void waitProgress();
+    virtual void signalProgress();
+
+  private:
+    void worker();
+
+    std::thread _thread;
+    std::mutex _lock;
+    std::condition_variable _work;
+    std::condition_variable _progress;
+    bool _pending;
+    bool _stop;
+};
+
+#endif
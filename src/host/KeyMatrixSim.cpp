@@ -0,0 +1,56 @@
+#include "KeyMatrixSim.h"
+
+KeyMatrixSim::KeyMatrixSim(SimClock &clock) : _clock(clock)
+{
+    int i;
+
+    bounceNs = 8000000;
+    chatterNs = 1300000;
+    _column = 0;
+    for (i = 0; i < KEYPAD_KEYS; i++)
+    {
+        _downNs[i] = _upNs[i] = 0;
+    }
+}
+
+void KeyMatrixSim::press(int key, uint64_t downNs, uint64_t upNs)
+{
+    _downNs[key] = downNs;
+    _upNs[key] = upNs;
+}
+
+bool KeyMatrixSim::down(int key)
+{
+    uint64_t now = _clock.ns;
+    bool state = now >= _downNs[key] && now < _upNs[key];
+    uint64_t edge = now >= _upNs[key] ? _upNs[key] : _downNs[key];
+
+    if (_upNs[key] == 0)
+        return false; // never pressed
+    if (now >= edge && now - edge < bounceNs && ((now - edge) / chatterNs) & 1)
+        return !state;
+    return state;
+}
+
+void KeyMatrixSim::selectColumn(int column)
+{
+    _column = column;
+}
+
+unsigned char KeyMatrixSim::readRows()
+{
+    unsigned char rows = 0;
+    int row;
+
+    for (row = 0; row < KEYPAD_ROWS; row++)
+    {
+        if (down(row * KEYPAD_COLS + _column))
+            rows |= 1 << row;
+    }
+    return rows;
+}
+
+uint32_t KeyMatrixSim::nowUs()
+{
+    return (uint32_t)(_clock.ns / 1000);
+}
@@ -0,0 +1,42 @@
+#ifndef KEY_MATRIX_SIM_H
+#define KEY_MATRIX_SIM_H
+
+#include "SimClock.h"
+#include "../KeyMatrixPort.h"
+#include "../KeyScanner.h"
+
+/** Host model of the keypad matrix
+ *
+ *  Key presses are scripted in modelled time. For bounceNs after each edge
+ *  the contact chatters, reading the old and new state alternately.
+ */
+class KeyMatrixSim : public KeyMatrixPort {
+  public:
+    KeyMatrixSim(SimClock &clock);
+    virtual ~KeyMatrixSim() {};
+
+    /** Script one press of a key
+     *
+     *  @param key row * KEYPAD_COLS + column
+     *  @param downNs Modelled time the key goes down
+     *  @param upNs Modelled time the key is released
+     */
+    void press(int key, uint64_t downNs, uint64_t upNs);
+
+    virtual void selectColumn(int column);
+    virtual unsigned char readRows();
+    virtual uint32_t nowUs();
+
+    unsigned int bounceNs; // chatter after each edge
+    unsigned int chatterNs; // period of the chatter
+
+  private:
+    bool down(int key);
+
+    SimClock &_clock;
+    int _column;
+    uint64_t _downNs[KEYPAD_KEYS];
+    uint64_t _upNs[KEYPAD_KEYS];
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+
+/** Modelled time shared by the simulated LCD bus and font ROM
+ *
+ *  A periodic handler can be attached to stand in for a timer interrupt
+ *  (mbed Ticker); advance() runs it whenever modelled time passes its next
+ *  due time, i.e. between two bus accesses like a real interrupt would.
+ */
+struct SimClock {
+    SimClock() : ns(0), _handler(0), _arg(0), _periodNs(0), _dueNs(0), _inHandler(false) {};
+
+    /** Advance modelled time by dt ns */
+    void advance(uint64_t dt)
+    {
+        ns += dt;
+        while (_handler != 0 && !_inHandler && ns >= _dueNs)
+        {
+            _dueNs += _periodNs;
+            _inHandler = true;
+            _handler(_arg);
+            _inHandler = false;
+        }
+    }
+
+    /** Attach a periodic handler, NULL to detach
+     *
+     *  @param handler Called every periodNs of modelled time
+     *  @param arg Passed to the handler
+     *  @param periodNs Period in ns
+     */
+    void attach(void (*handler)(void *), void *arg, uint64_t periodNs)
+    {
+        _handler = handler;
+        _arg = arg;
+        _periodNs = periodNs;
+        _dueNs = ns + periodNs;
+    }
+
+    uint64_t ns;
+
+  private:
+    void (*_handler)(void *);
+    void *_arg;
+    uint64_t _periodNs;
+    uint64_t _dueNs;
+    bool _inHandler;
+};
+
+#endif
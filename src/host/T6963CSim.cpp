@@ -0,0 +1,182 @@
+#include <string.h>
+#include "T6963CSim.h"
+#include "../T6963C.h"
+
+T6963CSim::T6963CSim(SimClock &clock) : _clock(clock)
+{
+    timing.accessNs = 400;
+    timing.commandBusyNs = 1000;
+    timing.dataBusyNs = 600;
+    timing.autoBusyNs = 300;
+    memset(vram, 0, sizeof(vram));
+    reset();
+}
+
+void T6963CSim::reset()
+{
+    addr = 0;
+    textHome = 0;
+    textWidth = 0;
+    grphHome = 0;
+    grphWidth = 0;
+    offset = 0;
+    cursorX = 0;
+    cursorY = 0;
+    mode = 0;
+    display = 0;
+    cursorLines = 0;
+    violations = 0;
+
+    _busyUntil = _clock.ns;
+    _auto = AUTO_NONE;
+    _argCount = 0;
+    _readLatch = 0;
+    _error = false;
+}
+
+bool T6963CSim::busy()
+{
+    return _clock.ns < _busyUntil;
+}
+
+// One bus cycle: an access while busy is a protocol violation
+void T6963CSim::access(unsigned int busyNs)
+{
+    if (busy())
+    {
+        violations++;
+        _error = true;
+    }
+    _clock.advance(timing.accessNs);
+    _busyUntil = _clock.ns + busyNs;
+}
+
+unsigned char T6963CSim::doReadStatus()
+{
+    unsigned char status = 0x20; // lcdcEn
+    bool ready = !busy();
+
+    _clock.advance(timing.accessNs);
+    if (ready)
+    {
+        status |= 0x01; // comEn
+        if (_auto == AUTO_NONE)
+            status |= 0x02; // rwEn
+        else if (_auto == AUTO_R)
+            status |= 0x04; // aRD
+        else
+            status |= 0x08; // aWR
+    }
+    if (_error)
+        status |= 0x40;
+    if ((_clock.ns / 500000000ULL) & 1)
+        status |= 0x80; // blink
+    return status;
+}
+
+void T6963CSim::doWriteCommand(unsigned char command)
+{
+    unsigned short arg16 = _args[0] | (_args[1] << 8);
+
+    access(timing.commandBusyNs);
+
+    if (_auto != AUTO_NONE && command != AUTO_RESET)
+    {
+        // Only AUTO_RESET is accepted in auto mode
+        _error = true;
+        violations++;
+        return;
+    }
+
+    if (command == REG_CURSOR)
+    {
+        cursorX = _args[0];
+        cursorY = _args[1];
+    }
+    else if (command == REG_OFFSET)
+        offset = _args[0] & 0x1F;
+    else if (command == REG_ADDR)
+        addr = arg16;
+    else if (command == DISP_TEXT_HOME_ADDR)
+        textHome = arg16;
+    else if (command == DISP_TEXT_WIDTH)
+        textWidth = _args[0];
+    else if (command == DISP_GRPH_HOME_ADDR)
+        grphHome = arg16;
+    else if (command == DISP_GRPH_WIDTH)
+        grphWidth = _args[0];
+    else if ((command & 0xF0) == MODE_SET)
+        mode = command & 0x0F;
+    else if ((command & 0xF0) == ENA_BASE)
+        display = command & 0x0F;
+    else if ((command & 0xF8) == CURSOR_BASE)
+        cursorLines = (command & 0x07) + 1;
+    else if (command == AUTO_WRITE)
+        _auto = AUTO_W;
+    else if (command == AUTO_READ)
+        _auto = AUTO_R;
+    else if (command == AUTO_RESET)
+        _auto = AUTO_NONE;
+    else if (command == DATA_WRITE_UP || command == DATA_WRITE_DOWN || command == DATA_WRITE)
+    {
+        vram[addr] = _args[0];
+        if (command == DATA_WRITE_UP)
+            addr++;
+        else if (command == DATA_WRITE_DOWN)
+            addr--;
+    }
+    else if (command == DATA_READ_UP || command == DATA_READ_DOWN || command == DATA_READ)
+    {
+        _readLatch = vram[addr];
+        if (command == DATA_READ_UP)
+            addr++;
+        else if (command == DATA_READ_DOWN)
+            addr--;
+    }
+    else
+    {
+        _error = true;
+    }
+    _argCount = 0;
+}
+
+void T6963CSim::doWriteData(unsigned char data)
+{
+    bool lost;
+
+    if (_auto == AUTO_W)
+    {
+        // a byte written while busy is lost
+        lost = busy();
+        access(timing.autoBusyNs);
+        if (!lost)
+            vram[addr++] = data;
+        return;
+    }
+    access(timing.dataBusyNs);
+    if (_argCount < 2)
+    {
+        _args[_argCount++] = data;
+    }
+    else
+    {
+        _args[0] = _args[1];
+        _args[1] = data;
+    }
+}
+
+unsigned char T6963CSim::doReadData()
+{
+    if (_auto == AUTO_R)
+    {
+        access(timing.autoBusyNs);
+        return vram[addr++];
+    }
+    access(timing.dataBusyNs);
+    return _readLatch;
+}
+
+void T6963CSim::doDelay(unsigned int ns)
+{
+    _clock.advance(ns);
+}
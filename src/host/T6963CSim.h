@@ -0,0 +1,71 @@
+#ifndef T6963C_SIM_H
+#define T6963C_SIM_H
+
+#include "SimClock.h"
+#include "../LcdBus.h"
+
+/** Bus cycle and controller busy times of the simulator in ns */
+struct T6963CTiming {
+    unsigned int accessNs;      // one bus cycle (strobes + data pins)
+    unsigned int commandBusyNs; // controller busy after a command
+    unsigned int dataBusyNs;    // controller busy after a single data write
+    unsigned int autoBusyNs;    // controller busy after an auto mode data byte
+};
+
+/** Host model of a T6963C controller
+ *
+ *  Emulates the 64KB VRAM, the address pointer, the registers, auto
+ *  write/read mode and the status bits of union statusCode. After every
+ *  write the controller reports busy for the modelled time, so the driver
+ *  polls exactly as it would on the board. The status is sampled when the
+ *  read cycle starts. Accessing the controller while
+ *  it is busy sets the error bit and is counted in violations; an auto
+ *  write byte sent while busy is lost.
+ */
+class T6963CSim : public LcdBus {
+  public:
+    T6963CSim(SimClock &clock);
+    virtual ~T6963CSim() {};
+
+    virtual void reset();
+
+    T6963CTiming timing;
+
+    unsigned char vram[0x10000];
+    unsigned short addr;
+    unsigned short textHome;
+    unsigned char textWidth;
+    unsigned short grphHome;
+    unsigned char grphWidth;
+    unsigned char offset;
+    unsigned char cursorX;
+    unsigned char cursorY;
+    unsigned char mode;
+    unsigned char display;
+    unsigned char cursorLines;
+
+    unsigned long violations;
+
+  protected:
+    virtual unsigned char doReadStatus();
+    virtual void doWriteCommand(unsigned char command);
+    virtual void doWriteData(unsigned char data);
+    virtual unsigned char doReadData();
+    virtual void doDelay(unsigned int ns);
+
+  private:
+    enum AutoMode { AUTO_NONE, AUTO_W, AUTO_R };
+
+    bool busy();
+    void access(unsigned int busyNs);
+
+    SimClock &_clock;
+    uint64_t _busyUntil;
+    AutoMode _auto;
+    unsigned char _args[2];
+    int _argCount;
+    unsigned char _readLatch;
+    bool _error;
+};
+
+#endif
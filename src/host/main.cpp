@@ -0,0 +1,708 @@
+// Host build: runs the display code against the T6963C / GT20L16J1Y simulators
+// and prints the bus cost of each scenario.
+//
+//   .pio/build/native/program [rom dump] [--csv out.csv [--no-cpu]]
+//                             [--baseline bench/baseline.csv] [--threshold %] [--cpu-threshold %]
+//   .pio/build/native/program transpose
+//   .pio/build/native/program utf8
+//   .pio/build/native/program queue
+//   .pio/build/native/program draw
+//   .pio/build/native/program port
+//   .pio/build/native/program panels
+//   .pio/build/native/program mirror [mirror.bin]
+//   .pio/build/native/program layout
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "SimClock.h"
+#include "T6963CSim.h"
+#include "FontRomSim.h"
+#include "Bench.h"
+#include "BenchReport.h"
+#include "../T6963C.h"
+#include "../LcdLayout.h"
+#include "../GT20L16J1Y_font.h"
+#include "../KanjiText.h"
+#include "../FontSubset.h"
+#include "../ShadowVram.h"
+#include "../GlyphCache.h"
+#include "../CgramAllocator.h"
+#include "../BusTrace.h"
+#include "../DoubleBuffer.h"
+#include "../Surface.h"
+#include "../TextConsole.h"
+#include "../Widget.h"
+#include "../AttributePlane.h"
+#include "../FillEngine.h"
+#include "../KeyScanner.h"
+#include "KeyMatrixSim.h"
+
+static SimClock simClock;
+static T6963CSim LcdSim(simClock);
+static FontRomSim RomSim(simClock);
+static T6963C Lcd(LcdSim);
+static GT20L16J1Y_FONT CgRom(RomSim);
+static ShadowVram Vram(Lcd);
+static GlyphCache Glyphs(CgRom);
+static CgramAllocator Cgram(Vram, Glyphs);
+static DoubleBuffer Frames(Lcd, Vram);
+static Surface Canvas(Frames.graphics(), DISPLAY_WIDTH * 8, DISPLAY_HEIGHT * 8, DISPLAY_WIDTH);
+static TextConsole Console(Lcd);
+static AttributePlane Attributes(Lcd, Vram);
+static FillEngine Filler(Lcd, &Vram);
+static KeyMatrixSim Keys(simClock);
+static KeyScanner Keypad(Keys);
+
+static BenchReport Results;
+static uint64_t scenarioStart;
+static std::chrono::steady_clock::time_point cpuStart;
+
+static void begin()
+{
+    // close what the previous scenario or a resync left open
+    Lcd.flush();
+    LcdSim.clearCounters();
+    RomSim.clearCounters();
+    scenarioStart = simClock.ns;
+    cpuStart = std::chrono::steady_clock::now();
+}
+
+static void report(const char *name)
+{
+    ScenarioResult r;
+
+    // an open AUTO_WRITE burst belongs to this scenario
+    Lcd.flush();
+    r.cpuUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - cpuStart).count();
+    r.busUs = (simClock.ns - scenarioStart) / 1000.0;
+    strncpy(r.name, name, sizeof(r.name) - 1);
+    r.name[sizeof(r.name) - 1] = 0;
+    r.statusReads = LcdSim.counters.statusReads;
+    r.commandWrites = LcdSim.counters.commandWrites;
+    r.dataWrites = LcdSim.counters.dataWrites;
+    r.dataReads = LcdSim.counters.dataReads;
+    r.romTransactions = RomSim.counters.transactions;
+    r.romBytes = RomSim.counters.bytes;
+    Results.add(r);
+
+    printf("%-16s %8lu %8lu %8lu %8lu %8lu %8lu %12.1f %10.1f\n", name, r.statusReads, r.commandWrites,
+           r.dataWrites, r.dataReads, r.romTransactions, r.romBytes, r.busUs, r.cpuUs);
+}
+
+static void setup()
+{
+    union convIntByte conv;
+
+    Lcd.reset();
+    Lcd.waitForWrite();
+
+    Lcd.dataWrite2Bytes(REG_CURSOR, 0, 0);
+    Lcd.dataWrite2Bytes(REG_ADDR, 0, 0);
+    conv.iData = VRAM_TEXT_ADDR;
+    Lcd.dataWrite2Bytes(DISP_TEXT_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    Lcd.dataWrite2Bytes(DISP_TEXT_WIDTH, DISPLAY_WIDTH, 0);
+    conv.iData = VRAM_GRPH_ADDR;
+    Lcd.dataWrite2Bytes(DISP_GRPH_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    Lcd.dataWrite2Bytes(DISP_GRPH_WIDTH, DISPLAY_WIDTH, 0);
+    conv.iData = CGRAM_START >> 11;
+    Lcd.dataWrite2Bytes(REG_OFFSET, conv.ucData[0], conv.ucData[1]);
+
+    Lcd.commandSet(MODE_SET + MODE_OR + MODE_INT_CG);
+    Lcd.commandSet(ENA_BASE + ENA_TEXTGRPH);
+    Lcd.commandSet(CURSOR_BASE + 3);
+}
+
+#ifdef LCD_TRACE
+static uint32_t traceClock()
+{
+    return (uint32_t)simClock.ns;
+}
+
+static void traceWrite(const void *data, int length, void *file)
+{
+    fwrite(data, 1, length, (FILE *)file);
+}
+#endif
+
+// `count` first level kanji (SJIS 0x889F-) from the `first`th as a NUL terminated string
+static void kanjiRow(char *str, int first, int count)
+{
+    int code = 0x889F, i;
+
+    for (i = 0; i < first + count; i++)
+    {
+        if (i >= first)
+        {
+            *str++ = (char)(code >> 8);
+            *str++ = (char)code;
+        }
+        code++;
+        if ((code & 0xFF) == 0x7F)
+            code++;
+        else if ((code & 0xFF) == 0xFD)
+            code += 0x100 - 0xFD + 0x40;
+    }
+    *str = 0;
+}
+
+// Ticker stand-in
+static void scanKeys(void *)
+{
+    Keypad.scan();
+}
+
+// Widget screen: a full draw, then menu moves (scrolling twice and handing
+// the focus to the value field) while a value and a bar change
+static int widgets(WidgetHighlight highlight, const char *full, const char *delta)
+{
+    static const char *const items[] = {"Start", "Stop", "Settings", "Calibrate", "Log", "About"};
+    Label title(0, 0, DISPLAY_WIDTH, "LCD key unit");
+    Label name(0, 1, 12, "\xE6\xB8\xA9\xE5\xBA\xA6 [C]", 2);
+    Menu menu(0, 4, 12, 3, items, 6);
+    ValueField value(14, 4, 6, -40, 125);
+    ProgressBar bar(0, 8, DISPLAY_WIDTH, 100);
+    WidgetScreen screen(Lcd, Vram, &Cgram, highlight);
+    const char *item;
+    int i, x, y, width;
+
+    screen.add(title);
+    screen.add(name);
+    screen.add(menu);
+    screen.add(value);
+    screen.add(bar);
+    screen.begin();
+    begin();
+    screen.render();
+    report(full);
+
+    begin();
+    for (i = 0; i < 10; i++)
+    {
+        value.setValue(20 + i / 3);
+        bar.setValue(i * 10);
+        screen.key(i < 4 ? WIDGET_KEY_DOWN : WIDGET_KEY_UP);
+        if (i == 5)
+        {
+            // the selection at the top of the window
+            menu.highlight(&x, &y, &width);
+            for (item = items[menu.selection()], width = 0; *item; item++, width++)
+            {
+                if (LcdSim.vram[VRAM_TEXT_ADDR + y * DISPLAY_WIDTH + width] != *item - ' ')
+                {
+                    fprintf(stderr, "menu row %d does not show \"%s\"\n", y, items[menu.selection()]);
+                    return 1;
+                }
+            }
+        }
+        screen.render();
+    }
+    report(delta);
+    printf("  widgets: %lu renders, %lu redraws, %lu skipped, %lu highlight moves\n", screen.counters.renders,
+           screen.counters.redraws, screen.counters.skipped, screen.counters.highlights);
+
+    // the focus ended on the value field
+    if (screen.focused() != &value ||
+        (highlight == HIGHLIGHT_CURSOR && (LcdSim.cursorX != value.x() || LcdSim.cursorY != value.y())) ||
+        (highlight == HIGHLIGHT_INVERT &&
+         LcdSim.vram[VRAM_GRPH_ADDR + value.y() * DISPLAY_WIDTH + value.x()] != ATTR_REVERSE))
+    {
+        fprintf(stderr, "focus is not shown on the value field\n");
+        return 1;
+    }
+
+    // back to the plain text and graphics layers
+    for (i = 0; i < name.width(); i++)
+    {
+        Cgram.erase(i, name.y());
+    }
+    Vram.fill(VRAM_TEXT_ADDR, 0, TEXT_PAGE_SIZE);
+    Vram.fill(VRAM_GRPH_ADDR, 0, GRPH_PAGE_SIZE);
+    Vram.flush();
+    Lcd.commandSet(MODE_SET + MODE_OR + MODE_INT_CG);
+    Lcd.commandSet(ENA_BASE + ENA_TEXTGRPH);
+    Lcd.commandSet(CURSOR_BASE + 3);
+    return 0;
+}
+
+// 15 hiragana (SJIS 0x829F-) as a NUL terminated string
+// The display holds what the shadow says in [from, to)
+static bool shadowMatches(int from, int to)
+{
+    int i;
+
+    for (i = from; i < to; i++)
+    {
+        if (LcdSim.vram[i] != Vram.read(i))
+        {
+            fprintf(stderr, "shadow mismatch at 0x%04x\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void hiraganaRow(char *str, int first)
+{
+    int i;
+
+    for (i = 0; i < 15; i++)
+    {
+        str[i * 2] = (char)0x82;
+        str[i * 2 + 1] = (char)(0x9F + first + i);
+    }
+    str[30] = 0;
+}
+
+int main(int argc, char **argv)
+{
+    union convIntByte conv;
+    unsigned char rowData[DISPLAY_WIDTH];
+    char kanji[32];
+    char line[40];
+    unsigned char cgData[32];
+    const char *rom = NULL, *csv = NULL, *baseline = NULL;
+    double threshold = 5, cpuThreshold = 0;
+    bool csvCpu = true;
+    KeyEvent key;
+    unsigned long keyEvents[3] = {0, 0, 0};
+    uint64_t end;
+    unsigned long sent, violations;
+    unsigned int autoBusyNs;
+    int i, j;
+
+    if (argc > 1 && strcmp(argv[1], "transpose") == 0)
+        return benchTranspose();
+    if (argc > 1 && strcmp(argv[1], "utf8") == 0)
+        return benchUtf8();
+    if (argc > 1 && strcmp(argv[1], "queue") == 0)
+        return benchQueue();
+    if (argc > 1 && strcmp(argv[1], "draw") == 0)
+        return benchDraw();
+    if (argc > 1 && strcmp(argv[1], "port") == 0)
+        return benchPort();
+    if (argc > 1 && strcmp(argv[1], "panels") == 0)
+        return benchPanels();
+    if (argc > 1 && strcmp(argv[1], "mirror") == 0)
+        return benchMirror(argc > 2 ? argv[2] : "mirror.bin");
+    if (argc > 1 && strcmp(argv[1], "layout") == 0)
+        return benchLayout();
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc)
+            csv = argv[++i];
+        else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc)
+            baseline = argv[++i];
+        else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+            threshold = atof(argv[++i]);
+        else if (strcmp(argv[i], "--cpu-threshold") == 0 && i + 1 < argc)
+            cpuThreshold = atof(argv[++i]);
+        else if (strcmp(argv[i], "--no-cpu") == 0)
+            csvCpu = false;
+        else
+            rom = argv[i];
+    }
+    if (rom != NULL && !RomSim.load(rom))
+    {
+        fprintf(stderr, "cannot read font ROM dump: %s\n", rom);
+        return 1;
+    }
+
+#ifdef LCD_TRACE
+    busTrace.setClock(traceClock, 1000);
+#endif
+    printf("%-16s %8s %8s %8s %8s %8s %8s %12s %10s\n", "scenario",
+           "status", "command", "dataWr", "dataRd", "romTrans", "romBytes", "bus[us]", "cpu[us]");
+
+    // power-up contents: memoryClear() below does not reach CGRAM
+    memset(&LcdSim.vram[CGRAM_START], 0xA5, CGRAM_END - CGRAM_START);
+
+    begin();
+    setup();
+    report("setup");
+
+    // graphics area, cleared below
+    begin();
+    i = Lcd.calibrate(VRAM_GRPH_ADDR, 64);
+    report("calibrate");
+    printf("  calibrate: %d ns between auto write bytes\n", i);
+
+    begin();
+    Lcd.memoryClear(VRAM_START, VRAM_END);
+    report("memoryClear");
+
+    // Keys pressed while the main loop is busy clearing VRAM
+    begin();
+    Keys.press(5, simClock.ns + 2000000, simClock.ns + 60000000);
+    Keys.press(22, simClock.ns + 9000000, simClock.ns + 740000000);
+    Keys.press(27, simClock.ns + 300000000, simClock.ns + 350000000);
+    simClock.attach(scanKeys, 0, KEYPAD_SCAN_US * 1000ULL);
+    end = simClock.ns + 800000000;
+    while (simClock.ns < end)
+    {
+        Lcd.memoryClear(VRAM_START, VRAM_END);
+        while (Keypad.poll(key))
+        {
+            keyEvents[key.type]++;
+        }
+    }
+    simClock.attach(0, 0, 0);
+    report("keypad");
+    printf("  keypad: %lu press, %lu release, %lu repeat, %lu missed, %lu bounces\n",
+           keyEvents[KEY_PRESS], keyEvents[KEY_RELEASE], keyEvents[KEY_REPEAT],
+           Keypad.counters.missed, Keypad.counters.bounces);
+    printf("  keypad: debounce max %lu us, edge->poll max %lu us avg %lu us\n",
+           (unsigned long)Keypad.counters.maxDebounceUs, (unsigned long)Keypad.counters.maxLatencyUs,
+           (unsigned long)(Keypad.counters.latencyUs / Keypad.counters.polled));
+    if (keyEvents[KEY_PRESS] != 3 || keyEvents[KEY_RELEASE] != 3 || Keypad.counters.missed != 0)
+    {
+        fprintf(stderr, "keypad events lost\n");
+        return 1;
+    }
+
+    begin();
+    conv.iData = CGRAM_START + CGRAM_STORE_OFFSET;
+    Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+    hiraganaRow(kanji, 0);
+    writeKanjiStr(Lcd, CgRom, kanji);
+    report("writeKanjiStr");
+
+    begin();
+    Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+    kanjiRow(kanji, 0, 15);
+    writeKanjiStr(Lcd, CgRom, kanji);
+    report("kanjiRow");
+    hiraganaRow(kanji, 0);
+
+    // Same label twice through the glyph cache: the second row hits only
+    begin();
+    for (i = 0; i < 2; i++)
+    {
+        conv.iData = CGRAM_START + CGRAM_STORE_OFFSET;
+        Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+        writeKanjiStr(Lcd, Glyphs, kanji);
+    }
+    report("glyphCache");
+    printf("  glyph cache: %lu hits, %lu misses, %lu evictions\n",
+           Glyphs.counters.hits, Glyphs.counters.misses, Glyphs.counters.evictions);
+
+    begin();
+    for (i = 0; i < DISPLAY_HEIGHT; i++)
+    {
+        for (j = 0; j < DISPLAY_WIDTH; j++)
+        {
+            rowData[j] = (unsigned char)(i * DISPLAY_WIDTH + j);
+        }
+        conv.iData = VRAM_TEXT_ADDR + DISPLAY_WIDTH * i;
+        Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+        Lcd.autoDataWrite(rowData, DISPLAY_WIDTH);
+    }
+    report("textRewrite");
+
+    // Dashboard frame through the shadow: full text once, then a few cells
+    Lcd.memoryClear(VRAM_START, VRAM_END);
+    begin();
+    for (i = 0; i < DISPLAY_HEIGHT; i++)
+    {
+        for (j = 0; j < DISPLAY_WIDTH; j++)
+        {
+            rowData[j] = (unsigned char)(i * DISPLAY_WIDTH + j);
+        }
+        Vram.write(VRAM_TEXT_ADDR + DISPLAY_WIDTH * i, rowData, DISPLAY_WIDTH);
+    }
+    Vram.flush();
+    report("shadowFull");
+
+    begin();
+    for (i = 0; i < 4; i++)
+    {
+        rowData[0] = (unsigned char)('0' + i);
+        rowData[1] = (unsigned char)('9' - i);
+        Vram.write(VRAM_TEXT_ADDR + DISPLAY_WIDTH * (i * 3 + 2) + 20, rowData, 2);
+    }
+    Vram.flush();
+    report("shadowDelta");
+
+    // Kanji on the text layer: the same label on three rows shares one upload
+    begin();
+    for (i = 0; i < 3; i++)
+    {
+        Cgram.writeKanjiStr(0, 2 + i * 4, kanji);
+    }
+    Vram.flush();
+    report("cgramText");
+    printf("  cgram: %lu uploads, %lu shared, %lu evictions, %lu failures\n",
+           Cgram.counters.uploads, Cgram.counters.shared, Cgram.counters.evictions, Cgram.counters.failures);
+
+    // UTF-8 text with ASCII and kanji mixed
+    begin();
+    Cgram.writeUtf8Str(0, 14, "Temp \xE6\xB8\xA9\xE5\xBA\xA6 25\xE2\x84\x83");
+    Vram.flush();
+    report("utf8Text");
+
+    // A half-width glyph in a CG RAM slot: its right half is blank, and
+    // the zero bytes must reach CGRAM too
+    begin();
+    j = Cgram.putKanji(28, 14, 'A');
+    Vram.flush();
+    report("cgramHalfWidth");
+    if (j < 0 || !shadowMatches(CGRAM_SLOT_ADDR + j * 32, CGRAM_SLOT_ADDR + j * 32 + 32))
+        return 1;
+
+    if (widgets(HIGHLIGHT_CURSOR, "widgets", "widgetDelta") != 0 ||
+        widgets(HIGHLIGHT_INVERT, "widgetsInvert", "widgetDeltaInvert") != 0)
+        return 1;
+
+    // Attribute plane: a 12 cell highlight moving down 8 rows, then an
+    // alarm that the controller blinks by itself. Pixels below the plane
+    // stay there while it is enabled and must be gone after disable().
+    Vram.fill(VRAM_GRPH_ADDR + GRPH_PAGE_SIZE - DISPLAY_WIDTH, 0xFF, DISPLAY_WIDTH);
+    Vram.flush();
+    Attributes.enable();
+    sent = Vram.counters.bytes;
+    begin();
+    for (i = 0; i < 8; i++)
+    {
+        Attributes.set(0, i - 1 < 0 ? 0 : i - 1, ATTR_NORMAL, 12);
+        Attributes.set(0, i, ATTR_REVERSE, 12);
+        Attributes.flush();
+    }
+    Attributes.set(20, 15, ATTR_REVERSE, 10);
+    Attributes.modify(20, 15, 0, ATTR_BLINK, 10);
+    Attributes.flush();
+    report("attributes");
+    printf("  attributes: %lu runs, %lu cells, %lu bytes sent\n", Attributes.counters.runs,
+           Attributes.counters.cells, Vram.counters.bytes - sent);
+    if (LcdSim.vram[VRAM_GRPH_ADDR + 7 * DISPLAY_WIDTH] != ATTR_REVERSE ||
+        LcdSim.vram[VRAM_GRPH_ADDR + 6 * DISPLAY_WIDTH] != ATTR_NORMAL ||
+        LcdSim.vram[VRAM_GRPH_ADDR + 15 * DISPLAY_WIDTH + 29] != ATTR_REVERSE + ATTR_BLINK)
+    {
+        fprintf(stderr, "attribute plane does not match\n");
+        return 1;
+    }
+    Attributes.disable();
+    for (i = VRAM_GRPH_ADDR; i < VRAM_GRPH_ADDR + GRPH_PAGE_SIZE; i++)
+    {
+        if (LcdSim.vram[i] != 0)
+        {
+            fprintf(stderr, "graphics page not blank after the attribute plane: 0x%02x at 0x%04x\n", LcdSim.vram[i], i);
+            return 1;
+        }
+    }
+
+    // Fills: a text window 26 cells wide (its rows joined into one burst)
+    // and a striped graphics box, then a screen change clearing all of
+    // VRAM, where only what the shadow does not know is clear is written
+    begin();
+    Filler.fillText(2, 10, 26, 4, 'X' - ' ');
+    Filler.fillGraphics(4, 40, 10, 32, 0x55AA);
+    report("fillRect");
+    printf("  fill: %lu bursts (%lu bytes, %lu gap), %lu singles, %lu skipped\n", Filler.counters.bursts,
+           Filler.counters.burstBytes, Filler.counters.gapBytes, Filler.counters.singles, Filler.counters.skipped);
+
+    Filler.fillText(3, 11, 1, 1, 0);
+    Filler.fillText(20, 12, 2, 1, 0);
+    memset(&Filler.counters, 0, sizeof(Filler.counters));
+    begin();
+    Filler.fill(VRAM_START, VRAM_END, FILL_BYTE(0));
+    report("fillClear");
+    printf("  fill: %lu bursts (%lu bytes, %lu gap), %lu singles, %lu skipped\n", Filler.counters.bursts,
+           Filler.counters.burstBytes, Filler.counters.gapBytes, Filler.counters.singles, Filler.counters.skipped);
+    for (i = VRAM_START; i < VRAM_END; i++)
+    {
+        if (LcdSim.vram[i] != 0)
+        {
+            fprintf(stderr, "fill left 0x%02x at 0x%04x\n", LcdSim.vram[i], i);
+            return 1;
+        }
+    }
+
+    // The same clear of a fully drawn screen, like memoryClear above: the
+    // shadow knows nothing is clear, so every byte is written
+    Vram.fill(VRAM_START, 0x5A, VRAM_END - VRAM_START);
+    Vram.flush();
+    memset(&Filler.counters, 0, sizeof(Filler.counters));
+    begin();
+    Filler.fill(VRAM_START, VRAM_END, FILL_BYTE(0));
+    report("fillFull");
+    printf("  fill: %lu bursts (%lu bytes, %lu gap), %lu singles, %lu skipped\n", Filler.counters.bursts,
+           Filler.counters.burstBytes, Filler.counters.gapBytes, Filler.counters.singles, Filler.counters.skipped);
+    for (i = VRAM_START; i < VRAM_END; i++)
+    {
+        if (LcdSim.vram[i] != 0)
+        {
+            fprintf(stderr, "fill left 0x%02x at 0x%04x\n", LcdSim.vram[i], i);
+            return 1;
+        }
+    }
+
+    // Animation on two graphics pages: a 16x16 block moving 8 pixels a frame
+    begin();
+    for (i = 0; i < 8; i++)
+    {
+        Canvas.fill(ROP_CLEAR);
+        Canvas.fillRect(16 + i * 8, 40, 16, 16);
+        Frames.present();
+        if (LcdSim.grphHome != VRAM_GRPH_PAGE(Frames.frontPage()) ||
+            memcmp(&LcdSim.vram[LcdSim.grphHome], Frames.graphics(), GRPH_PAGE_SIZE) != 0)
+        {
+            fprintf(stderr, "page flip shows an unfinished frame\n");
+            return 1;
+        }
+    }
+    report("pageFlip");
+    printf("  pageFlip: %lu frames, %lu bytes sent\n", Frames.counters.frames, Frames.counters.bytes);
+
+    // Log pane: one long (wrapped) line, then 100 lines of 9 characters
+    Console.begin();
+    begin();
+    Console.puts("this line is longer than the display and wraps twice onto the next rows\n");
+    for (i = 0; i < 100; i++)
+    {
+        sprintf(line, "line %04d\n", i);
+        Console.puts(line);
+    }
+    report("console");
+    printf("  console: %lu lines, %lu scrolls, %lu bytes (%lu per line)\n", Console.counters.lines,
+           Console.counters.scrolls, Console.counters.bytes, Console.counters.bytes / Console.counters.lines);
+    for (i = 0; i < DISPLAY_HEIGHT - 1; i++)
+    {
+        sprintf(line, "line %04d", 100 - (DISPLAY_HEIGHT - 1) + i);
+        for (j = 0; line[j]; j++)
+        {
+            if (LcdSim.vram[LcdSim.textHome + i * DISPLAY_WIDTH + j] != line[j] - ' ')
+            {
+                fprintf(stderr, "console row %d does not show \"%s\"\n", i, line);
+                return 1;
+            }
+        }
+    }
+    Console.end();
+
+    // Every CGRAM cell: CGRAM_COUNT / 4 kanji, 15 per string
+    begin();
+    conv.iData = CGRAM_START + CGRAM_STORE_OFFSET;
+    Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+    for (i = 0; i < CGRAM_COUNT / 4; i += 15)
+    {
+        kanjiRow(kanji, i, CGRAM_COUNT / 4 - i < 15 ? CGRAM_COUNT / 4 - i : 15);
+        writeKanjiStr(Lcd, CgRom, kanji);
+    }
+    report("cgramUpload");
+    // the shadow no longer matches CGRAM
+    Vram.invalidate();
+    Vram.flush();
+
+    begin();
+    Lcd.dataWrite2Bytes(REG_CURSOR, 5, 3);
+    Lcd.commandSet(CURSOR_BASE + 7);
+    report("cursor");
+
+    begin();
+    for (i = 0; i < 100; i++)
+    {
+        Lcd.statusRead();
+    }
+    report("status");
+
+    // A controller slower than calibrated: the boundary check finds it
+    // busy, the driver returns to polling and writes the burst again
+    violations = LcdSim.violations;
+    autoBusyNs = LcdSim.timing.autoBusyNs;
+    LcdSim.timing.autoBusyNs = autoBusyNs * 4;
+    for (i = 0; i < DISPLAY_WIDTH; i++)
+    {
+        rowData[i] = (unsigned char)('A' + i - ' ');
+    }
+    begin();
+    Vram.write(VRAM_TEXT_ADDR + DISPLAY_WIDTH * 15, rowData, DISPLAY_WIDTH);
+    Vram.flush();
+    report("timedFallback");
+    LcdSim.timing.autoBusyNs = autoBusyNs;
+    if (Lcd.counters.fallbacks != 1 || memcmp(&LcdSim.vram[VRAM_TEXT_ADDR + DISPLAY_WIDTH * 15], rowData, DISPLAY_WIDTH) != 0)
+    {
+        fprintf(stderr, "timed burst was not written again after the fallback\n");
+        return 1;
+    }
+    // the overrun was forced
+    LcdSim.violations = violations;
+
+    // Flash font subset (fonts/host_corpus.txt, compiled from the simulated
+    // ROM) mixed with ROM glyphs: □あ■い△▲, written by the prefetching
+    // writer and then through the glyph cache; only あ and い are read
+    strcpy(kanji, "\x81\xA0\x82\xA0\x81\xA1\x82\xA2\x81\xA2\x81\xA3");
+    Glyphs.clear();
+    Glyphs.clearCounters();
+    begin();
+    conv.iData = CGRAM_START + CGRAM_STORE_OFFSET;
+    Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+    writeKanjiStr(Lcd, CgRom, kanji);
+    sent = RomSim.counters.bytes;
+    writeKanjiStr(Lcd, Glyphs, kanji);
+    report("fontSubset");
+    printf("  glyph cache: %lu flash, %lu hits, %lu misses\n", Glyphs.counters.flash, Glyphs.counters.hits,
+           Glyphs.counters.misses);
+    if (fontSubsetCount == 0 || sent != 2 * 32 || Glyphs.counters.flash != 4 || Glyphs.counters.misses != 2)
+    {
+        fprintf(stderr, "font subset not used (%u glyphs, %lu ROM bytes)\n", fontSubsetCount, sent);
+        return 1;
+    }
+    // a ROM dump does not match the subset compiled from the simulated ROM
+    for (i = 0; rom == NULL && i < 12; i++)
+    {
+        conv.iData = ((unsigned char)kanji[(i % 6) * 2] << 8) | (unsigned char)kanji[(i % 6) * 2 + 1];
+        CgRom.read(conv.iData);
+        transposeCg(CgRom.bitmap, cgData);
+        if (memcmp(&LcdSim.vram[CGRAM_START + CGRAM_STORE_OFFSET + i * 32], cgData, 32) != 0)
+        {
+            fprintf(stderr, "glyph %d of the font subset row does not match the ROM\n", i);
+            return 1;
+        }
+    }
+    // the rows went around the shadow
+    Vram.markDirty(CGRAM_START + CGRAM_STORE_OFFSET, 12 * 32);
+    Vram.flush();
+
+    printf("state cache: %lu addresses, %lu registers, %lu commands elided, %lu bursts merged\n",
+           Lcd.counters.elidedAddresses, Lcd.counters.elidedRegisters, Lcd.counters.elidedCommands,
+           Lcd.counters.mergedBursts);
+    printf("timed writes: %lu fallbacks, %lu lost bursts\n", Lcd.counters.fallbacks, Lcd.counters.lostBursts);
+
+    if (!shadowMatches(VRAM_START, VRAM_END) || !shadowMatches(CGRAM_START, CGRAM_END))
+        return 1;
+    if (LcdSim.violations != 0)
+    {
+        fprintf(stderr, "bus protocol violations: %lu\n", LcdSim.violations);
+        return 1;
+    }
+    if (csv != NULL && !Results.writeCsv(csv, csvCpu))
+    {
+        fprintf(stderr, "cannot write %s\n", csv);
+        return 1;
+    }
+    if (baseline != NULL)
+    {
+        i = Results.compare(baseline, threshold, cpuThreshold);
+        if (i < 0)
+        {
+            fprintf(stderr, "cannot read baseline %s\n", baseline);
+            return 1;
+        }
+        if (i > 0)
+        {
+            fprintf(stderr, "%d scenario(s) slower than the baseline\n", i);
+            return 1;
+        }
+    }
+#ifdef LCD_TRACE
+    FILE *trace = fopen("bustrace.bin", "wb");
+    if (trace != NULL)
+    {
+        busTrace.dump(traceWrite, trace);
+        fclose(trace);
+        printf("bus trace written to bustrace.bin (python3 tracedump.py bustrace.bin)\n");
+    }
+#endif
+    return 0;
+}
@@ -1,136 +1,100 @@
 #include <mbed.h>
 #include "GT20L16J1Y_font.h"
+#include "T6963C.h"
+#include "LcdLayout.h"
+#include "KanjiText.h"
+#include "GlyphCache.h"
+#include "FillEngine.h"
+#include "KeyScanner.h"
+#include "BusTrace.h"
+#include "PortLcdBus.h"
+#include "PanelScheduler.h"
+#include "mbed/MbedLcdBus.h"
+#include "mbed/Stm32Gpio.h"
+#include "mbed/MbedKeyMatrix.h"
+#include "mbed/MbedDisplayQueue.h"
 #include <locale.h>
 #include <cwchar>
 
+#ifndef KEYPAD_POLL_MS
+#define KEYPAD_POLL_MS 5 // main loop sleep between key queue polls (the display thread runs meanwhile)
+#endif
+
 // LCD
-BusInOut LcdData(D2, D3, D4, D5, D6, D7, D8, D9); // LCDf[^oX
-DigitalOut Lcd_WR(D10);                           // ~ݐM(0=Active)
-DigitalOut Lcd_RD(D11);                           // ~ǂݍݐM(0=Active)
-DigitalOut Lcd_CE(D12);                           // ~`bvZNg(0=Active)
-DigitalOut LcdCommandData(D13);                   // WX^I(1=R}hA0=f[^)
-DigitalOut Lcd_Reset(D14);                        // ~Zbg(0=Reset)
-
-// L[pbh
-BusIn PadRow(PC_4, PB_13, PB_14, PC_15, PB_1, PB_2, PB_12); // s
-BusOut PadCol(A1, A2, A3, A4);                              // 
-DigitalOut PadBackLight(PA_11);                             // obNCg
+#ifdef LCD_BUS_INOUT
+BusInOut LcdData(D2, D3, D4, D5, D6, D7, D8, D9); // LCDデータバス
+DigitalOut Lcd_WR(D10);                           // ~書き込み信号(0=Active)
+DigitalOut Lcd_RD(D11);                           // ~読み込み信号(0=Active)
+DigitalOut Lcd_CE(D12);                           // ~チップセレクト(0=Active)
+DigitalOut LcdCommandData(D13);                   // レジスタ選択(1=コマンド、0=データ)
+DigitalOut Lcd_Reset(D14);                        // ~リセット(0=Reset)
+#ifdef LCD_PANEL2_CE
+DigitalOut Lcd2_CE(LCD_PANEL2_CE, 1); // second panel: ~CE only, the rest is shared
+#endif
+#else
+// D2-D9 data, D10 ~WR, D11 ~RD, D12 ~CE, D13 C/D, D14 ~RESET (same pins as above)
+struct LcdPins {
+    static const int DB0 = PA_10, DB1 = PB_3, DB2 = PB_5, DB3 = PB_4, DB4 = PB_10, DB5 = PA_8, DB6 = PA_9, DB7 = PC_7;
+    static const int WR = PB_6, RD = PA_7, CE = PA_6, CD = PA_5, RST = PB_9;
+};
+#ifdef LCD_PANEL2_CE
+// second panel: ~CE only, the rest is shared
+struct Lcd2Pins : LcdPins {
+    static const int CE = LCD_PANEL2_CE;
+};
+#endif
+#endif
+
+// キーパッド
+BusIn PadRow(PC_4, PB_13, PB_14, PC_15, PB_1, PB_2, PB_12); // 行
+BusOut PadCol(A1, A2, A3, A4);                              // 列
+DigitalOut PadBackLight(PA_11);                             // バックライト
 DigitalOut PadIndicator(PA_12);                             // LED
 
-GT20L16J1Y_FONT CgRom(PC_12, PC_11, PC_10, PA_15);
+#ifdef LCD_BUS_INOUT
+MbedLcdBus LcdPort(LcdData, Lcd_WR, Lcd_RD, Lcd_CE, LcdCommandData, Lcd_Reset);
+#else
+PortLcdBus<Stm32Gpio, LcdPins> LcdPort;
+#endif
+T6963C Lcd(LcdPort);
+#ifdef LCD_PANEL2_CE
+#ifdef LCD_BUS_INOUT
+MbedLcdBus LcdPort2(LcdData, Lcd_WR, Lcd_RD, Lcd2_CE, LcdCommandData, Lcd_Reset);
+#else
+PortLcdBus<Stm32Gpio, Lcd2Pins> LcdPort2;
+#endif
+T6963C Lcd2(LcdPort2);
+PanelScheduler Panels;
+#endif
+MbedDisplayQueue Display(Lcd);
+FillEngine Filler(Lcd); // no shadow: full width fills are one burst
 
-#define DISPLAY_WIDTH 30  // fBXvC(8*nhbg)
-#define DISPLAY_HEIGHT 16 // fBXvCs(8*n hbg)
+GT20L16J1Y_FONT CgRom(PC_12, PC_11, PC_10, PA_15);
+GlyphCache Glyphs(CgRom);
 
-#define VRAM_START 0x0000                                                        // VRAMJnAhX
-#define VRAM_TEXT_ADDR VRAM_START                                                // eLXgJnAhX
-#define VRAM_GRPH_ADDR (VRAM_TEXT_ADDR + (DISPLAY_WIDTH * DISPLAY_HEIGHT))       // OtBbNJnAhX
-#define VRAM_END (VRAM_GRPH_ADDR + ((DISPLAY_WIDTH * (DISPLAY_HEIGHT * 8)) * 2)) // VRAMIAhX
-#define CGRAM_START ((VRAM_END & 0xF800) + 0x1800)                               // CGRAMJnAhX
-#define CGRAM_STORE_OFFSET 0x400                                                 // R[h0x80ȍ~ɒu߂̃ItZbg
-#define CGRAM_COUNT 0x800                                                        // CGRAMɓo^镶
-#define CGRAM_END (CGRAM_START + CGRAM_STORE_OFFSET + (8 * CGRAM_COUNT))         // CGRAMIAhX
+MbedKeyMatrix PadMatrix(PadRow, PadCol);
+KeyScanner Keypad(PadMatrix);
+Ticker PadTicker;
 
 void reset();
-union statusCode statusRead();
-void waitForWrite();
-void waitForAutoRead();
-void waitForAutoWrite();
-void dataWrite2Bytes(unsigned char command, unsigned char ldata, unsigned char hdata);
-void dataWriteByte(unsigned char command, unsigned char data);
-void autoDataRead(unsigned char *dataArray, int length);
-void autoDataWrite(unsigned char *dataArray, int length);
-unsigned char dataRead(unsigned char command);
-void memoryClear(int from, int to);
-void commandSet(unsigned char command);
-void lcdPutc(char chr);
-void lcdPuts(unsigned char *str);
-void read2BytesCg(unsigned char *cgData, unsigned short code);
-void writeKanjiStr(char *str);
-
-union statusCode {
-    unsigned int usData;
-    struct
-    {
-        unsigned int comEn : 1;  // R}hs\H 1=s 0=ss
-        unsigned int rwEn : 1;   // f[^[hECg\H 1=s 0=ss
-        unsigned int aRD : 1;    // I[gf[^[h\H 1=s 0=ss
-        unsigned int aWR : 1;    // I[gf[^Cg\H 1=s 0=ss
-        unsigned int dummy : 1;  // gp
-        unsigned int lcdcEn : 1; // LCDC\H 1= 0=s
-        unsigned int error : 1;  // G[tO 1=G[ 0=
-        unsigned int blink : 1;  // uNtO 1=\ 0=\
-    } tBit;
-};
+void setupPanel(T6963C &lcd);
 
-union convIntByte {
-    int iData;
-    unsigned char ucData[2];
-};
-
-union convUShortByte {
-    unsigned short usData;
-    unsigned char ucData[2];
-};
-
-enum Commands
+#ifdef LCD_TRACE
+// Cortex-M cycle counter as the trace clock
+static uint32_t traceClock()
 {
-    // WX^Zbg
-    REG_CURSOR = 0x21, // J[\|C^Zbg X,Y
-    REG_OFFSET,        // ItZbgWX^Zbg Data,00H
-    REG_ADDR = 0x24,   // AhX|C^Zbg lData,HData
-
-    // ʐݒ
-    DISP_TEXT_HOME_ADDR = 0x40, // \eLXgz[AhXZbg lData,HData
-    DISP_TEXT_WIDTH,            // eLXgGAw Data,00H
-    DISP_GRPH_HOME_ADDR,        // \OtBbNz[AhXZbg lData,HData
-    DISP_GRPH_WIDTH,            // OtBbNGAw Data,00H
-
-    // [hZbg
-    MODE_SET = 0x80,       // [hZbg
-    MODE_OR = 0x00,        // \OR[h MODE_SETɑނ
-    MODE_EXOR = 0x01,      // \EXOR[h MODE_SETɑނ
-    MODE_AND = 0x03,       // \AND[h MODE_SETɑނ
-    MODE_TEXT_ATTR = 0x04, // eLXgAgr[g MODE_SETɑނ
-    MODE_INT_CG = 0x00,    // CG[h MODE_SETɑނ
-    MODE_EXT_CG = 0x08,    // OCG[h MODE_SETɑނ
-
-    // \Cl[u
-    ENA_BASE = 0x90,            // \Cl[u P̎gp"\֎~"
-    ENA_CURSOR_NOTBLINK = 0x02, // J[\\uN֎~ ENA_BASEɑނ
-    ENA_CURSOR_BLINK = 0x03,    // J[\\uN ENA_BASEɑނ
-    ENA_TEXTONLY = 0x04,        // eLXg\OtBbN֎~  ENA_BASEɑނ
-    ENA_GRPHONLY = 0x08,        // OtBbN\eLXg֎~ ENA_BASEɑނ
-    ENA_TEXTGRPH = 0x0C,        // eLXgEOtBbN\   ENA_BASEɑނ
-
-    // J[\w
-    CURSOR_BASE = 0xA0, // n+1CJ[\ (n=0`7(1C`8C)A)
-
-    // I[gw
-    AUTO_WRITE = 0xB0, // f[^I[gCgZbg
-    AUTO_READ,         // f[^I[g[hZbg
-    AUTO_RESET,        // I[gZbg(I[gw)
-
-    // f[^q^v
-    DATA_WRITE_UP = 0xC0, // f[^CgAbv data
-    DATA_READ_UP,         // f[^[hAbv
-    DATA_WRITE_DOWN,      // f[^Cg_E data
-    DATA_READ_DOWN,       // f[^[h_E
-    DATA_WRITE,           // f[^Cg data
-    DATA_READ,            // f[^[h
-
-    // XN[s[N(gȂ)
-    SCR_PEEK = 0xE0,
-
-    // XN[Rs[(gȂ)
-    SCR_COPY = 0xE8
+    return DWT->CYCCNT;
+}
 
-};
+static void traceWrite(const void *data, int length, void *)
+{
+    fwrite(data, 1, length, stdout);
+}
+#endif
 
 int main()
 {
 
-    union statusCode stcd;
     union convIntByte conv;
     unsigned char writeData[0x100];
     unsigned char stringsData[16][31] =
@@ -160,8 +124,8 @@ int main()
 
     int i, j;
     char writeChr[32];
-
-    stcd.usData = 0;
+    KeyEvent key;
+    unsigned char keyText[2];
 
     // put your setup code here, to run once:
 
@@ -180,61 +144,68 @@ int main()
             stringsData[i + 1][j + 1] = (30 * i + 2 * j) + 3;
         }
     }
+#ifdef LCD_TRACE
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    busTrace.setClock(traceClock, SystemCoreClock / 1000000);
+#endif
     reset();
-    waitForWrite();
-
-    dataWrite2Bytes(REG_CURSOR, 0, 0);
-    dataWrite2Bytes(REG_ADDR, 0, 0);
-    conv.iData = VRAM_TEXT_ADDR;
-    dataWrite2Bytes(DISP_TEXT_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
-    dataWrite2Bytes(DISP_TEXT_WIDTH, DISPLAY_WIDTH, 0);
-    conv.iData = VRAM_GRPH_ADDR;
-    dataWrite2Bytes(DISP_GRPH_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
-    dataWrite2Bytes(DISP_GRPH_WIDTH, DISPLAY_WIDTH, 0);
-    conv.iData = CGRAM_START >> 11;
-    dataWrite2Bytes(REG_OFFSET, conv.ucData[0], conv.ucData[1]);
-
-    commandSet(MODE_SET + MODE_OR + MODE_INT_CG);
-    commandSet(ENA_BASE + ENA_TEXTGRPH);
-    commandSet(CURSOR_BASE + 3);
-
-    memoryClear(VRAM_START, VRAM_END);
+    PadTicker.attach(callback(&Keypad, &KeyScanner::scan), std::chrono::microseconds(KEYPAD_SCAN_US));
+    setupPanel(Lcd);
+#ifdef LCD_PANEL2_CE
+    setupPanel(Lcd2);
+    Panels.add(Lcd, LcdPort);
+    Panels.add(Lcd2, LcdPort2);
+#endif
+
+    // timed auto writes from here on; the graphics area is cleared below
+    Lcd.calibrate(VRAM_GRPH_ADDR, 64);
+#ifdef LCD_PANEL2_CE
+    // the panels need not be equally fast
+    Lcd2.calibrate(VRAM_GRPH_ADDR, 64);
+    // both panels at once: one clears while the other is busy
+    Panels.fill(PANEL_ALL, VRAM_START, 0, VRAM_END - VRAM_START);
+    Panels.run();
+#else
+    Lcd.memoryClear(VRAM_START, VRAM_END);
+#endif
 
     conv.iData = CGRAM_START + CGRAM_STORE_OFFSET /*  + CGRAM_STORE_OFFSET */;
     //conv.iData = VRAM_GRPH_ADDR;
-    dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+    Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
 
     //                 123456789012345678901234567890
-    strncpy(writeChr, "", sizeof(writeChr));
-    writeKanjiStr(writeChr);
+    strncpy(writeChr, "あいうえおかきくけこさしすせそ", sizeof(writeChr));
+    writeKanjiStr(Lcd, Glyphs, writeChr);
 
-    strncpy(writeChr, "ĂƂȂɂʂ˂̂͂Ђӂւ", sizeof(writeChr));
-    writeKanjiStr(writeChr);
+    strncpy(writeChr, "たちつてとなにぬねのはひふへほ", sizeof(writeChr));
+    writeKanjiStr(Lcd, Glyphs, writeChr);
 
-    strncpy(writeChr, "܂݂ނ߂", sizeof(writeChr));
-    writeKanjiStr(writeChr);
+    strncpy(writeChr, "まみむめもやゆよらりるれろわん", sizeof(writeChr));
+    writeKanjiStr(Lcd, Glyphs, writeChr);
 
-    strncpy(writeChr, "JK@@@", sizeof(writeChr));
-    writeKanjiStr(writeChr);
+    strncpy(writeChr, "をぁぃぅぇぉっゃゅょ゛゜　　　", sizeof(writeChr));
+    writeKanjiStr(Lcd, Glyphs, writeChr);
 
     // CgRom.read(0x938c);
-    // autoDataWrite(CgRom.bitmap, 32);
+    // Lcd.autoDataWrite(CgRom.bitmap, 32);
     // CgRom.read(0x8ec5);
-    // autoDataWrite(CgRom.bitmap, 32);
+    // Lcd.autoDataWrite(CgRom.bitmap, 32);
 
     conv.iData = VRAM_TEXT_ADDR;
-    dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+    Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
     for (i = 0; i < 16; i++)
     {
         conv.iData = 0x1e * (i + 1);
-        autoDataWrite(writeData + (i * 0x10), 0x10);
-        dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+        Lcd.autoDataWrite(writeData + (i * 0x10), 0x10);
+        Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
     }
 
     thread_sleep_for(3000);
-    memoryClear(VRAM_TEXT_ADDR, VRAM_GRPH_ADDR);
+    Filler.fillText(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
     conv.iData = VRAM_TEXT_ADDR;
-    dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+    Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
     for (i = 0; i < 16; i++)
     {
         if (i == 8)
@@ -242,33 +213,53 @@ int main()
             thread_sleep_for(2000);
 
             conv.iData = (CGRAM_START >> 11) + 1;
-            dataWrite2Bytes(REG_OFFSET, conv.ucData[0], conv.ucData[1]);
+            Lcd.dataWrite2Bytes(REG_OFFSET, conv.ucData[0], conv.ucData[1]);
         }
         conv.iData = 0x1e * ((i + 1));
-        autoDataWrite(stringsData[i], 30);
-        dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
+        Lcd.autoDataWrite(stringsData[i], 30);
+        Lcd.dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
         if (i == 15)
         {
             thread_sleep_for(2000);
 
             conv.iData = (CGRAM_START >> 11);
-            dataWrite2Bytes(REG_OFFSET, conv.ucData[0], conv.ucData[1]);
+            Lcd.dataWrite2Bytes(REG_OFFSET, conv.ucData[0], conv.ucData[1]);
         }
     }
 
     /* for (i = 0; i < 0x80; i++)
     {
-        dataWriteByte(0xC0, writeData[i]);
+        Lcd.dataWriteByte(0xC0, writeData[i]);
     }
  */
+#ifdef LCD_TRACE
+    // the demo above, for tracedump.py
+    busTrace.dump(traceWrite, NULL);
+    fflush(stdout);
+#endif
+
+    // from here on the display thread owns Lcd
+    Display.start();
+
     while (1)
     {
         // put your main code here, to run repeatedly:
-        stcd.usData = statusRead().usData;
-        //printf("%d\n",stcd.usData);
-        PadIndicator = ((stcd.tBit.comEn && stcd.tBit.lcdcEn && stcd.tBit.rwEn) ? 1 : 0);
-        Lcd_RD = 1;
-        Lcd_WR = 1;
+        while (Keypad.poll(key))
+        {
+            if (key.type == KEY_RELEASE)
+            {
+                PadIndicator = 0;
+                continue;
+            }
+            PadIndicator = 1;
+
+            // key number at the top left corner
+            keyText[0] = '0' + key.key / 10 - ' ';
+            keyText[1] = '0' + key.key % 10 - ' ';
+            Display.write(VRAM_TEXT_ADDR, keyText, 2);
+        }
+        // block: the display thread runs below normal priority
+        thread_sleep_for(KEYPAD_POLL_MS);
     }
 }
 
@@ -276,405 +267,36 @@ void reset()
 {
     // printf("Resetting...");
     fflush(stdout);
-    Lcd_Reset = 0;
-
-    LcdData.output();
-    LcdCommandData = 0;
-    LcdData = 0;
-    Lcd_WR = 1;
-    Lcd_RD = 1;
-
     PadCol = 0;
     PadBackLight = 1;
     PadIndicator = 1;
 
-    Lcd_CE = 1;
-    thread_sleep_for(5);
-    Lcd_Reset = 1;
-    thread_sleep_for(5);
+    Lcd.reset();
     fflush(stdout);
     PadBackLight = 0;
     PadIndicator = 0;
     // printf("Done!\n");
 }
 
-union statusCode statusRead()
+// Display layout registers and modes (panels share ~RESET, so reset() first)
+void setupPanel(T6963C &lcd)
 {
-    union statusCode stcd;
-    stcd.usData = 0;
-
-    LcdData.input();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 0;
-    Lcd_WR = 1;
-    stcd.usData = LcdData.read();
-    Lcd_RD = 1;
-    Lcd_CE = 1;
-    Lcd_WR = 1;
-
-    LcdData.output();
-    // printf("%2x ", stcd.usData);
-    return stcd;
-}
-
-void waitForWrite()
-{
-    union statusCode stcd;
-
-    // printf("Waiting for write...");
-    fflush(stdout);
-
-    while (1)
-    {
-        stcd.usData = statusRead().usData;
-
-        if ((stcd.tBit.comEn == 1 && /* stcd.tBit.lcdcEn == 1 && */ stcd.tBit.rwEn == 1))
-            break;
-    }
-    // printf("Done!\n");
-    fflush(stdout);
-}
-
-void waitForAutoWrite()
-{
-    union statusCode stcd;
-    // printf("Waiting for auto write...");
-    fflush(stdout);
-
-    while (1)
-    {
-
-        stcd.usData = statusRead().usData;
-        if ((stcd.tBit.comEn == 1 && /* stcd.tBit.lcdcEn == 1 &&  */ stcd.tBit.aWR == 1))
-            break;
-    }
-    // printf("Done!\n");
-    fflush(stdout);
-}
-void waitForAutoRead()
-{
-    union statusCode stcd;
-    // printf("Waiting for auto read...");
-    fflush(stdout);
-    while (1)
-    {
-        stcd.usData = statusRead().usData;
-        if ((stcd.tBit.comEn == 1 && /*  stcd.tBit.lcdcEn == 1 &&  */ stcd.tBit.aRD == 1))
-            break;
-    }
-    // printf("Done!\n");
-    fflush(stdout);
-}
-
-void dataWrite2Bytes(unsigned char command, unsigned char ldata, unsigned char hdata)
-{
-    // printf("Data Write CMD=0x%02x DATA=0x%02x 0x%02x\n", command, hdata, ldata);
-    fflush(stdout);
-    waitForWrite();
-    LcdCommandData = 0;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = ldata;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-
-    waitForWrite();
-    LcdCommandData = 0;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = hdata;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-
-    waitForWrite();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = command;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-}
-
-void dataWriteByte(unsigned char command, unsigned char data)
-{
-    // printf("Data Write CMD=0x%02x DATA=0x%02x\n", command, data);
-    fflush(stdout);
-    waitForWrite();
-    LcdCommandData = 0;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = data;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-
-    waitForWrite();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = command;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-}
-
-void autoDataRead(unsigned char *dataArray, int length)
-{
-    int i;
-    union convIntByte conv;
-
-    waitForWrite();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = AUTO_READ;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-
-    for (i = 0; i < length; i++)
-    {
-        waitForAutoRead();
-        LcdCommandData = 0;
-        Lcd_CE = 0;
-        Lcd_RD = 0;
-        Lcd_WR = 1;
-        LcdData.input();
-        conv.iData = LcdData.read();
-        LcdData.output();
-        dataArray[i] = conv.ucData[0];
-        Lcd_CE = 1;
-        Lcd_RD = 1;
-        Lcd_WR = 1;
-    }
-    waitForAutoRead();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = AUTO_RESET;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-
-    // printf("Read data is...\n");
-
-    // for (i = 0; i < length; i++)
-    // {
-    //     printf("%02x ", dataArray[i]);
-    //     if (i % 16 == 0)
-    //         printf("\n");
-    // }
-    // printf("\n");
-}
-
-void autoDataWrite(unsigned char *dataArray, int length)
-{
-    int i;
-    waitForWrite();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = AUTO_WRITE;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-
-    for (i = 0; i < length; i++)
-    {
-        waitForAutoWrite();
-        // printf("Write data is... %02x\n", dataArray[i]);
-
-        LcdCommandData = 0;
-        Lcd_CE = 0;
-        Lcd_RD = 1;
-        Lcd_WR = 0;
-        LcdData = dataArray[i];
-        Lcd_CE = 1;
-        Lcd_RD = 1;
-        Lcd_WR = 1;
-    }
-    waitForAutoWrite();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = AUTO_RESET;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-}
-void memoryClear(int from, int to)
-{
-    int i;
     union convIntByte conv;
-    // printf("Memory Clear...");
-
-    conv.iData = from;
-
-    dataWrite2Bytes(REG_ADDR, conv.ucData[0], conv.ucData[1]);
-    waitForWrite();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = AUTO_WRITE;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-
-    for (i = 0; i < (to - from); i++)
-    {
-        //printf("addr:%04x  ",i);
-        waitForAutoWrite();
-        LcdCommandData = 0;
-        Lcd_CE = 0;
-        Lcd_RD = 1;
-        Lcd_WR = 0;
-        LcdData = 0;
-        Lcd_CE = 1;
-        Lcd_RD = 1;
-        Lcd_WR = 1;
-    }
-    waitForAutoWrite();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = AUTO_RESET;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-}
 
-unsigned char dataRead(unsigned char command)
-{
-    union convIntByte conv;
-    waitForWrite();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = command;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-
-    waitForWrite();
-    LcdCommandData = 0;
-    Lcd_CE = 0;
-    Lcd_RD = 0;
-    Lcd_WR = 1;
-    LcdData.input();
-    conv.iData = LcdData.read();
-    LcdData.output();
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-
-    // printf("Data Write CMD=0x%02x DATA=0x%02x\n", command, conv.ucData[0]);
-
-    return conv.ucData[0];
-}
+    lcd.waitForWrite();
 
-void lcdPutc(char chr)
-{
-    dataWriteByte(DATA_WRITE_UP, chr >= ' ' ? chr - ' ' : 0);
-}
-
-void lcdPuts(unsigned char *str)
-{
-    unsigned int i = 0;
-    for (i = 0; i < strlen((char *)str); i++)
-    {
-        dataWriteByte(DATA_WRITE_UP, str[i] >= ' ' ? str[i] - ' ' : 0);
-    }
-}
-
-void commandSet(unsigned char command)
-{
-    // printf("Sending Command CMD=0x%02x\n", command);
-    waitForWrite();
-    LcdCommandData = 1;
-    Lcd_CE = 0;
-    Lcd_RD = 1;
-    Lcd_WR = 0;
-    LcdData = command;
-    Lcd_CE = 1;
-    Lcd_RD = 1;
-    Lcd_WR = 1;
-}
-
-union BitConverter {
-    unsigned char ucData;
-    struct
-    {
-        unsigned char bit0 : 1;
-        unsigned char bit1 : 1;
-        unsigned char bit2 : 1;
-        unsigned char bit3 : 1;
-        unsigned char bit4 : 1;
-        unsigned char bit5 : 1;
-        unsigned char bit6 : 1;
-        unsigned char bit7 : 1;
-    } tBit;
-};
-void read2BytesCg(unsigned char *cgData, unsigned short code)
-{
-    union BitConverter bc;
-    int i, j;
-
-    // printf("! read2BytesData\n");
-    for (i = 0; i < 32; i++)
-    {
-        cgData[i] = 0;
-    }
+    lcd.dataWrite2Bytes(REG_CURSOR, 0, 0);
+    lcd.dataWrite2Bytes(REG_ADDR, 0, 0);
+    conv.iData = VRAM_TEXT_ADDR;
+    lcd.dataWrite2Bytes(DISP_TEXT_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    lcd.dataWrite2Bytes(DISP_TEXT_WIDTH, DISPLAY_WIDTH, 0);
+    conv.iData = VRAM_GRPH_ADDR;
+    lcd.dataWrite2Bytes(DISP_GRPH_HOME_ADDR, conv.ucData[0], conv.ucData[1]);
+    lcd.dataWrite2Bytes(DISP_GRPH_WIDTH, DISPLAY_WIDTH, 0);
+    conv.iData = CGRAM_START >> 11;
+    lcd.dataWrite2Bytes(REG_OFFSET, conv.ucData[0], conv.ucData[1]);
 
-    CgRom.read(code);
-    for (i = 0; i < 4; i++)
-    {
-        // for (j = 0; j < 8; j++)
-        // {
-        for (j = 0; j < 8; j++)
-        {
-            bc.ucData = CgRom.bitmap[i * 8 + (7 - j)];
-            cgData[i * 8 + 0] += bc.tBit.bit0 << j;
-            cgData[i * 8 + 1] += bc.tBit.bit1 << j;
-            cgData[i * 8 + 2] += bc.tBit.bit2 << j;
-            cgData[i * 8 + 3] += bc.tBit.bit3 << j;
-            cgData[i * 8 + 4] += bc.tBit.bit4 << j;
-            cgData[i * 8 + 5] += bc.tBit.bit5 << j;
-            cgData[i * 8 + 6] += bc.tBit.bit6 << j;
-            cgData[i * 8 + 7] += bc.tBit.bit7 << j;
-        }
-        // }
-    }
+    lcd.commandSet(MODE_SET + MODE_OR + MODE_INT_CG);
+    lcd.commandSet(ENA_BASE + ENA_TEXTGRPH);
+    lcd.commandSet(CURSOR_BASE + 3);
 }
-
-void writeKanjiStr(char *str)
-{
-    unsigned int i;
-    union convUShortByte conv;
-    unsigned char cgData[32];
-    // char buf[256];
-    // utf8tosjis(str,strlen(str),buf,sizeof(buf));
-
-    for (i = 0; i < strlen(str); i += 2)
-    {
-        conv.ucData[1] = str[i];
-        conv.ucData[0] = str[i + 1];
-        read2BytesCg(cgData, conv.usData);
-        autoDataWrite(cgData, 32);
-    }
-}
\ No newline at end of file
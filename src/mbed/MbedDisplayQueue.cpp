@@ -0,0 +1,38 @@
+#include "MbedDisplayQueue.h"
+
+#define FLAG_WORK 0x01
+#define FLAG_PROGRESS 0x02
+
+MbedDisplayQueue::MbedDisplayQueue(T6963C &lcd)
+    : DisplayQueue(lcd), _thread(osPriorityBelowNormal, DISPLAY_THREAD_STACK, NULL, "display")
+{
+}
+
+void MbedDisplayQueue::start()
+{
+    _thread.start(callback(this, &MbedDisplayQueue::worker));
+}
+
+void MbedDisplayQueue::worker()
+{
+    while (1)
+    {
+        _flags.wait_any(FLAG_WORK);
+        drain();
+    }
+}
+
+void MbedDisplayQueue::wakeWorker()
+{
+    _flags.set(FLAG_WORK);
+}
+
+void MbedDisplayQueue::waitProgress()
+{
+    _flags.wait_any(FLAG_PROGRESS, 1);
+}
+
+void MbedDisplayQueue::signalProgress()
+{
+    _flags.set(FLAG_PROGRESS);
+}
@@ -0,0 +1,36 @@
+#ifndef MBED_DISPLAY_QUEUE_H
+#define MBED_DISPLAY_QUEUE_H
+
+#include "mbed.h"
+#include "../DisplayQueue.h"
+
+#ifndef DISPLAY_THREAD_STACK
+#define DISPLAY_THREAD_STACK 1024
+#endif
+
+/** DisplayQueue drained by an mbed RTOS thread
+ *
+ *  The thread runs below normal priority: it busy-polls the T6963C status
+ *  while a command runs, so it only gets the time the application leaves.
+ */
+class MbedDisplayQueue : public DisplayQueue {
+  public:
+    MbedDisplayQueue(T6963C &lcd);
+    virtual ~MbedDisplayQueue() {};
+
+    /** Start the display thread; the T6963C belongs to it from now on */
+    void start();
+
+  protected:
+    virtual void wakeWorker();
+    virtual void waitProgress();
+    virtual void signalProgress();
+
+  private:
+    void worker();
+
+    Thread _thread;
+    EventFlags _flags;
+};
+
+#endif
@@ -0,0 +1,77 @@
+#include "MbedFontRomPort.h"
+
+MbedFontRomPort::MbedFontRomPort(PinName mosi, PinName miso, PinName sclk, PinName cs) : _busy(false), _spi(mosi, miso, sclk, NC), _CS(cs)
+{
+    // Setup the spi for 8 bit data, high steady state clock
+    _spi.format(8,3);
+    _spi.frequency(10000000);
+#if DEVICE_SPI_ASYNCH
+    _spi.set_dma_usage(DMA_USAGE_ALWAYS);
+    memset(_tx, 0, sizeof(_tx));
+#endif
+}
+
+bool MbedFontRomPort::busy()
+{
+    return _busy;
+}
+
+void MbedFontRomPort::doRead(uint32_t address, unsigned char *data, int length)
+{
+    waitIdle();
+
+    // Deselect the device
+    _CS = 1;
+
+    // Select the device by seting chip select low
+    _CS = 0;
+    _spi.write(0x03);    // Read data byte
+    _spi.write(address>>16 & 0xff);
+    _spi.write(address>>8 & 0xff);
+    _spi.write(address & 0xff);
+
+    for(int i=0; i<length; i++)
+    {
+        data[i] = _spi.write(0x00);
+    }
+
+    // Deselect the device
+    _CS = 1;
+}
+
+#if DEVICE_SPI_ASYNCH
+void MbedFontRomPort::doStartRead(uint32_t address, unsigned char *data, int length)
+{
+    if (length > FONT_ROM_ASYNC_MAX)
+    {
+        doRead(address, data, length);
+        return;
+    }
+    waitIdle();
+
+    _tx[0] = 0x03;    // Read data byte
+    _tx[1] = address>>16 & 0xff;
+    _tx[2] = address>>8 & 0xff;
+    _tx[3] = address & 0xff;
+    _dest = data;
+    _length = length;
+    _busy = true;
+
+    _CS = 1;
+    _CS = 0;
+    _spi.transfer(_tx, 4 + length, _rx, 4 + length, callback(this, &MbedFontRomPort::transferDone), SPI_EVENT_COMPLETE);
+}
+
+// SPI completion (interrupt context)
+void MbedFontRomPort::transferDone(int event)
+{
+    _CS = 1;
+    memcpy(_dest, _rx + 4, _length);
+    _busy = false;
+}
+#else
+void MbedFontRomPort::doStartRead(uint32_t address, unsigned char *data, int length)
+{
+    doRead(address, data, length);
+}
+#endif
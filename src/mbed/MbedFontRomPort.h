@@ -0,0 +1,44 @@
+#ifndef MBED_FONT_ROM_PORT_H
+#define MBED_FONT_ROM_PORT_H
+
+#include "mbed.h"
+#include "../FontRomPort.h"
+
+/** GT20L16J1Y font ROM connected to an mbed SPI
+ *
+ *  On targets with DEVICE_SPI_ASYNCH, startRead() runs as a DMA transfer
+ *  and releases CS from the completion callback.
+ */
+class MbedFontRomPort : public FontRomPort {
+  public:
+    /** Create a font ROM port connected to the specified pins
+     *
+     *  @param mosi Serial data output pin to connect to
+     *  @param miso Serial data input pin to connect to
+     *  @param sclk Serial clock input pin to connect to
+     *  @param cs Chip enable input pin to connect to
+     */
+    MbedFontRomPort(PinName mosi, PinName miso, PinName sclk, PinName cs);
+    virtual ~MbedFontRomPort() {};
+
+    virtual bool busy();
+
+  protected:
+    virtual void doRead(uint32_t address, unsigned char *data, int length);
+    virtual void doStartRead(uint32_t address, unsigned char *data, int length);
+
+  private:
+#if DEVICE_SPI_ASYNCH
+    void transferDone(int event);
+
+    unsigned char _tx[4 + FONT_ROM_ASYNC_MAX];
+    unsigned char _rx[4 + FONT_ROM_ASYNC_MAX];
+    unsigned char *_dest;
+    int _length;
+#endif
+    volatile bool _busy;
+    SPI _spi;
+    DigitalOut _CS;
+};
+
+#endif
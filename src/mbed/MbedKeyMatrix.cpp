@@ -0,0 +1,22 @@
+#include "MbedKeyMatrix.h"
+#include "../KeyScanner.h"
+
+MbedKeyMatrix::MbedKeyMatrix(BusIn &rows, BusOut &cols) : _rows(rows), _cols(cols)
+{
+    _rows.mode(PullUp);
+}
+
+void MbedKeyMatrix::selectColumn(int column)
+{
+    _cols = ~(1 << column) & ((1 << KEYPAD_COLS) - 1);
+}
+
+unsigned char MbedKeyMatrix::readRows()
+{
+    return ~_rows.read() & ((1 << KEYPAD_ROWS) - 1);
+}
+
+uint32_t MbedKeyMatrix::nowUs()
+{
+    return us_ticker_read();
+}
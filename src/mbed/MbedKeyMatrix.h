@@ -0,0 +1,31 @@
+#ifndef MBED_KEY_MATRIX_H
+#define MBED_KEY_MATRIX_H
+
+#include "mbed.h"
+#include "../KeyMatrixPort.h"
+
+/** Key matrix on mbed BusIn / BusOut pins
+ *
+ *  Columns are driven low one at a time; rows are read with pull-ups, so a
+ *  pressed key reads 0 on its row.
+ */
+class MbedKeyMatrix : public KeyMatrixPort {
+  public:
+    /** Create a key matrix on already constructed pins
+     *
+     *  @param rows Row inputs
+     *  @param cols Column outputs
+     */
+    MbedKeyMatrix(BusIn &rows, BusOut &cols);
+    virtual ~MbedKeyMatrix() {};
+
+    virtual void selectColumn(int column);
+    virtual unsigned char readRows();
+    virtual uint32_t nowUs();
+
+  private:
+    BusIn &_rows;
+    BusOut &_cols;
+};
+
+#endif
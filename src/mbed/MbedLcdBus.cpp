@@ -0,0 +1,77 @@
+#include "MbedLcdBus.h"
+
+MbedLcdBus::MbedLcdBus(BusInOut &data, DigitalOut &wr, DigitalOut &rd, DigitalOut &ce, DigitalOut &cd, DigitalOut &rst)
+    : _data(data), _WR(wr), _RD(rd), _CE(ce), _CD(cd), _RST(rst)
+{
+}
+
+void MbedLcdBus::reset()
+{
+    _RST = 0;
+
+    _data.output();
+    _CD = 0;
+    _data = 0;
+    _WR = 1;
+    _RD = 1;
+
+    _CE = 1;
+    thread_sleep_for(5);
+    _RST = 1;
+    thread_sleep_for(5);
+}
+
+void MbedLcdBus::write(int cd, unsigned char value)
+{
+    _CD = cd;
+    _CE = 0;
+    _RD = 1;
+    _WR = 0;
+    _data = value;
+    _CE = 1;
+    _RD = 1;
+    _WR = 1;
+}
+
+unsigned char MbedLcdBus::read(int cd)
+{
+    unsigned char value;
+
+    _data.input();
+    _CD = cd;
+    _CE = 0;
+    _RD = 0;
+    _WR = 1;
+    value = _data.read();
+    _RD = 1;
+    _CE = 1;
+    _WR = 1;
+    _data.output();
+
+    return value;
+}
+
+unsigned char MbedLcdBus::doReadStatus()
+{
+    return read(1);
+}
+
+void MbedLcdBus::doWriteCommand(unsigned char command)
+{
+    write(1, command);
+}
+
+void MbedLcdBus::doWriteData(unsigned char data)
+{
+    write(0, data);
+}
+
+unsigned char MbedLcdBus::doReadData()
+{
+    return read(0);
+}
+
+void MbedLcdBus::doDelay(unsigned int ns)
+{
+    wait_ns(ns);
+}
@@ -0,0 +1,43 @@
+#ifndef MBED_LCD_BUS_H
+#define MBED_LCD_BUS_H
+
+#include "mbed.h"
+#include "../LcdBus.h"
+
+/** T6963C bus driven through mbed BusInOut / DigitalOut pins */
+class MbedLcdBus : public LcdBus {
+  public:
+    /** Create a bus on already constructed pins
+     *
+     *  @param data D0-D7 data bus
+     *  @param wr ~WR strobe (0=Active)
+     *  @param rd ~RD strobe (0=Active)
+     *  @param ce ~CE chip enable (0=Active)
+     *  @param cd C/D register select (1=command, 0=data)
+     *  @param rst ~RESET (0=Reset)
+     */
+    MbedLcdBus(BusInOut &data, DigitalOut &wr, DigitalOut &rd, DigitalOut &ce, DigitalOut &cd, DigitalOut &rst);
+    virtual ~MbedLcdBus() {};
+
+    virtual void reset();
+
+  protected:
+    virtual unsigned char doReadStatus();
+    virtual void doWriteCommand(unsigned char command);
+    virtual void doWriteData(unsigned char data);
+    virtual unsigned char doReadData();
+    virtual void doDelay(unsigned int ns);
+
+  private:
+    void write(int cd, unsigned char value);
+    unsigned char read(int cd);
+
+    BusInOut &_data;
+    DigitalOut &_WR;
+    DigitalOut &_RD;
+    DigitalOut &_CE;
+    DigitalOut &_CD;
+    DigitalOut &_RST;
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef STM32_GPIO_H
+#define STM32_GPIO_H
+
+#include "mbed.h"
+
+/** STM32 GPIO register access for PortLcdBus; pins are mbed PinNames */
+struct Stm32Gpio {
+    static GPIO_TypeDef *regs(int port)
+    {
+        return (GPIO_TypeDef *)(uintptr_t)(GPIOA_BASE + port * (GPIOB_BASE - GPIOA_BASE));
+    }
+
+    // through the HAL once: enables the port clock
+    static void output(int pin)
+    {
+        gpio_t gpio;
+        gpio_init_out(&gpio, (PinName)pin);
+    }
+
+    static void bsrr(int port, uint32_t value)
+    {
+        regs(port)->BSRR = value;
+    }
+
+    static void moder(int port, uint32_t mask, uint32_t value)
+    {
+        GPIO_TypeDef *gpio = regs(port);
+
+        // read-modify-write: other drivers share the port
+        core_util_critical_section_enter();
+        gpio->MODER = (gpio->MODER & ~mask) | value;
+        core_util_critical_section_exit();
+    }
+
+    static uint32_t idr(int port)
+    {
+        return regs(port)->IDR;
+    }
+
+    static void wait(unsigned int ns)
+    {
+        wait_ns(ns);
+    }
+
+    static void sleep(int ms)
+    {
+        thread_sleep_for(ms);
+    }
+};
+
+#endif
@@ -0,0 +1,143 @@
+# Bus trace converter
+#
+# Reads a BusTrace dump (LCD_TRACE builds, see src/BusTrace.h) and writes a
+# Chrome trace (chrome://tracing, Perfetto) plus per-operation latency
+# histograms on stdout. The dump may be preceded by other serial output;
+# everything before the "LTRC" magic is skipped.
+#
+#   python3 tracedump.py bustrace.bin [--json bustrace.json]
+
+import argparse
+import json
+import math
+import struct
+import sys
+
+KINDS = ['command', 'write burst', 'read burst', 'status wait', 'rom read', 'rom start']
+WAITS = ['write', 'auto write', 'auto read']
+COMMANDS = {
+    0x21: 'REG_CURSOR', 0x22: 'REG_OFFSET', 0x24: 'REG_ADDR',
+    0x40: 'DISP_TEXT_HOME_ADDR', 0x41: 'DISP_TEXT_WIDTH',
+    0x42: 'DISP_GRPH_HOME_ADDR', 0x43: 'DISP_GRPH_WIDTH',
+    0xB0: 'AUTO_WRITE', 0xB1: 'AUTO_READ', 0xB2: 'AUTO_RESET',
+    0xC0: 'DATA_WRITE_UP', 0xC1: 'DATA_READ_UP', 0xC2: 'DATA_WRITE_DOWN',
+    0xC3: 'DATA_READ_DOWN', 0xC4: 'DATA_WRITE', 0xC5: 'DATA_READ',
+}
+
+
+def command_name(code):
+    if code in COMMANDS:
+        return COMMANDS[code]
+    for base, name in ((0xA0, 'CURSOR'), (0x90, 'ENA'), (0x80, 'MODE_SET')):
+        if code >= base:
+            return '%s+%d' % (name, code - base)
+    return '0x%02X' % code
+
+
+def load(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    at = data.find(b'LTRC')
+    if at < 0:
+        sys.exit('%s: no trace found' % path)
+    version, ticks_per_us, recorded, kept = struct.unpack_from('<4I', data, at + 4)
+    if version != 1:
+        sys.exit('%s: unsupported trace version %d' % (path, version))
+    events = []
+    offset = at + 20
+    last_raw = None
+    last = 0
+    for i in range(kept):
+        start, duration, kind, arg, count = struct.unpack_from('<IIBBH', data, offset + 12 * i)
+        # unwrap the 32-bit clock; events are close together in time
+        if last_raw is not None:
+            delta = (start - last_raw) & 0xFFFFFFFF
+            if delta >= 0x80000000:
+                delta -= 0x100000000
+            last += delta
+        last_raw = start
+        events.append((last, duration, kind, arg, count))
+    return ticks_per_us, recorded, events
+
+
+def name_of(kind, arg):
+    if kind == 0:
+        return command_name(arg)
+    if kind == 3:
+        return 'wait ' + WAITS[arg] if arg < len(WAITS) else 'wait'
+    return KINDS[kind]
+
+
+def chrome(events, ticks_per_us):
+    out = []
+    base = min(e[0] for e in events) if events else 0
+    for start, duration, kind, arg, count in events:
+        out.append({
+            'name': name_of(kind, arg),
+            'cat': KINDS[kind] if kind < len(KINDS) else 'unknown',
+            'ph': 'X',
+            'ts': (start - base) / ticks_per_us,
+            'dur': duration / ticks_per_us,
+            'pid': 1,
+            'tid': 2 if kind >= 4 else 1,  # LCD bus / font ROM SPI
+            'args': {'count': count},
+        })
+    return {'traceEvents': out, 'displayTimeUnit': 'ns'}
+
+
+def histogram(title, values, unit):
+    if not values:
+        return
+    values.sort()
+    print('%s: %d, min %s, median %s, p99 %s, max %s %s' % (
+        title, len(values), fmt(values[0]), fmt(values[len(values) // 2]),
+        fmt(values[min(len(values) - 1, len(values) * 99 // 100)]), fmt(values[-1]), unit))
+    buckets = {}
+    for v in values:
+        b = math.floor(math.log2(v)) if v > 0 else None
+        buckets[b] = buckets.get(b, 0) + 1
+    peak = max(buckets.values())
+    for b in sorted(buckets, key=lambda b: -1000 if b is None else b):
+        label = '0' if b is None else '%s - %s' % (fmt(2.0 ** b), fmt(2.0 ** (b + 1)))
+        print('  %-16s %8d %s' % (label, buckets[b], '#' * max(1, buckets[b] * 40 // peak)))
+
+
+def fmt(v):
+    return ('%.3f' % v).rstrip('0').rstrip('.') if isinstance(v, float) else str(v)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a BusTrace dump')
+    parser.add_argument('dump')
+    parser.add_argument('--json', help='Chrome trace output (default: <dump>.json)')
+    args = parser.parse_args()
+
+    ticks_per_us, recorded, events = load(args.dump)
+    out = args.json or args.dump.rsplit('.', 1)[0] + '.json'
+    with open(out, 'w') as f:
+        json.dump(chrome(events, ticks_per_us), f)
+    print('%d events (%d recorded, %d overwritten) -> %s' % (
+        len(events), recorded, recorded - len(events), out))
+
+    # time per operation; commands and bursts include the waits inside them
+    total = {}
+    for start, duration, kind, arg, count in events:
+        key = name_of(kind, arg) if kind == 3 else KINDS[kind]
+        total[key] = total.get(key, 0) + duration
+    print('%-20s %12s' % ('operation', 'total [us]'))
+    for key in sorted(total, key=total.get, reverse=True):
+        print('%-20s %12.1f' % (key, total[key] / ticks_per_us))
+    print()
+
+    for kind in range(len(KINDS)):
+        if kind == 3:
+            for wait in range(len(WAITS)):
+                sel = [e for e in events if e[2] == 3 and e[3] == wait]
+                histogram('wait %s latency' % WAITS[wait], [e[1] / ticks_per_us for e in sel], 'us')
+                histogram('wait %s polls' % WAITS[wait], [e[4] for e in sel], 'polls')
+            continue
+        histogram(KINDS[kind] + ' latency', [e[1] / ticks_per_us for e in events if e[2] == kind], 'us')
+
+
+if __name__ == '__main__':
+    main()